@@ -0,0 +1,544 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/extension/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/binder/CMakeLists.txt"
+  "/root/repo/src/binder/bind/CMakeLists.txt"
+  "/root/repo/src/binder/bind/copy/CMakeLists.txt"
+  "/root/repo/src/binder/bind/ddl/CMakeLists.txt"
+  "/root/repo/src/binder/bind/read/CMakeLists.txt"
+  "/root/repo/src/binder/bind_expression/CMakeLists.txt"
+  "/root/repo/src/binder/ddl/CMakeLists.txt"
+  "/root/repo/src/binder/expression/CMakeLists.txt"
+  "/root/repo/src/binder/query/CMakeLists.txt"
+  "/root/repo/src/binder/rewriter/CMakeLists.txt"
+  "/root/repo/src/binder/visitor/CMakeLists.txt"
+  "/root/repo/src/c_api/CMakeLists.txt"
+  "/root/repo/src/catalog/CMakeLists.txt"
+  "/root/repo/src/catalog/catalog_entry/CMakeLists.txt"
+  "/root/repo/src/common/CMakeLists.txt"
+  "/root/repo/src/common/arrow/CMakeLists.txt"
+  "/root/repo/src/common/copier_config/CMakeLists.txt"
+  "/root/repo/src/common/data_chunk/CMakeLists.txt"
+  "/root/repo/src/common/enums/CMakeLists.txt"
+  "/root/repo/src/common/exception/CMakeLists.txt"
+  "/root/repo/src/common/file_system/CMakeLists.txt"
+  "/root/repo/src/common/serializer/CMakeLists.txt"
+  "/root/repo/src/common/signal/CMakeLists.txt"
+  "/root/repo/src/common/task_system/CMakeLists.txt"
+  "/root/repo/src/common/types/CMakeLists.txt"
+  "/root/repo/src/common/types/value/CMakeLists.txt"
+  "/root/repo/src/common/vector/CMakeLists.txt"
+  "/root/repo/src/expression_evaluator/CMakeLists.txt"
+  "/root/repo/src/extension/CMakeLists.txt"
+  "/root/repo/src/function/CMakeLists.txt"
+  "/root/repo/src/function/aggregate/CMakeLists.txt"
+  "/root/repo/src/function/arithmetic/CMakeLists.txt"
+  "/root/repo/src/function/array/CMakeLists.txt"
+  "/root/repo/src/function/cast/CMakeLists.txt"
+  "/root/repo/src/function/date/CMakeLists.txt"
+  "/root/repo/src/function/export/CMakeLists.txt"
+  "/root/repo/src/function/gds/CMakeLists.txt"
+  "/root/repo/src/function/list/CMakeLists.txt"
+  "/root/repo/src/function/map/CMakeLists.txt"
+  "/root/repo/src/function/path/CMakeLists.txt"
+  "/root/repo/src/function/pattern/CMakeLists.txt"
+  "/root/repo/src/function/sequence/CMakeLists.txt"
+  "/root/repo/src/function/string/CMakeLists.txt"
+  "/root/repo/src/function/struct/CMakeLists.txt"
+  "/root/repo/src/function/table/CMakeLists.txt"
+  "/root/repo/src/function/table/call/CMakeLists.txt"
+  "/root/repo/src/function/union/CMakeLists.txt"
+  "/root/repo/src/function/utility/CMakeLists.txt"
+  "/root/repo/src/graph/CMakeLists.txt"
+  "/root/repo/src/main/CMakeLists.txt"
+  "/root/repo/src/optimizer/CMakeLists.txt"
+  "/root/repo/src/parser/CMakeLists.txt"
+  "/root/repo/src/parser/antlr_parser/CMakeLists.txt"
+  "/root/repo/src/parser/expression/CMakeLists.txt"
+  "/root/repo/src/parser/transform/CMakeLists.txt"
+  "/root/repo/src/parser/visitor/CMakeLists.txt"
+  "/root/repo/src/planner/CMakeLists.txt"
+  "/root/repo/src/planner/join_order/CMakeLists.txt"
+  "/root/repo/src/planner/operator/CMakeLists.txt"
+  "/root/repo/src/planner/operator/ddl/CMakeLists.txt"
+  "/root/repo/src/planner/operator/extend/CMakeLists.txt"
+  "/root/repo/src/planner/operator/factorization/CMakeLists.txt"
+  "/root/repo/src/planner/operator/persistent/CMakeLists.txt"
+  "/root/repo/src/planner/operator/scan/CMakeLists.txt"
+  "/root/repo/src/planner/operator/simple/CMakeLists.txt"
+  "/root/repo/src/planner/plan/CMakeLists.txt"
+  "/root/repo/src/processor/CMakeLists.txt"
+  "/root/repo/src/processor/map/CMakeLists.txt"
+  "/root/repo/src/processor/operator/CMakeLists.txt"
+  "/root/repo/src/processor/operator/aggregate/CMakeLists.txt"
+  "/root/repo/src/processor/operator/ddl/CMakeLists.txt"
+  "/root/repo/src/processor/operator/hash_join/CMakeLists.txt"
+  "/root/repo/src/processor/operator/intersect/CMakeLists.txt"
+  "/root/repo/src/processor/operator/macro/CMakeLists.txt"
+  "/root/repo/src/processor/operator/order_by/CMakeLists.txt"
+  "/root/repo/src/processor/operator/persistent/CMakeLists.txt"
+  "/root/repo/src/processor/operator/persistent/reader/CMakeLists.txt"
+  "/root/repo/src/processor/operator/persistent/reader/csv/CMakeLists.txt"
+  "/root/repo/src/processor/operator/persistent/reader/npy/CMakeLists.txt"
+  "/root/repo/src/processor/operator/persistent/reader/parquet/CMakeLists.txt"
+  "/root/repo/src/processor/operator/persistent/reader/rdf/CMakeLists.txt"
+  "/root/repo/src/processor/operator/persistent/writer/parquet/CMakeLists.txt"
+  "/root/repo/src/processor/operator/recursive_extend/CMakeLists.txt"
+  "/root/repo/src/processor/operator/scan/CMakeLists.txt"
+  "/root/repo/src/processor/operator/simple/CMakeLists.txt"
+  "/root/repo/src/processor/operator/table_scan/CMakeLists.txt"
+  "/root/repo/src/processor/result/CMakeLists.txt"
+  "/root/repo/src/storage/CMakeLists.txt"
+  "/root/repo/src/storage/buffer_manager/CMakeLists.txt"
+  "/root/repo/src/storage/compression/CMakeLists.txt"
+  "/root/repo/src/storage/index/CMakeLists.txt"
+  "/root/repo/src/storage/local_storage/CMakeLists.txt"
+  "/root/repo/src/storage/predicate/CMakeLists.txt"
+  "/root/repo/src/storage/stats/CMakeLists.txt"
+  "/root/repo/src/storage/storage_structure/CMakeLists.txt"
+  "/root/repo/src/storage/store/CMakeLists.txt"
+  "/root/repo/src/storage/wal/CMakeLists.txt"
+  "/root/repo/src/transaction/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/c_api/CMakeLists.txt"
+  "/root/repo/test/common/CMakeLists.txt"
+  "/root/repo/test/copy/CMakeLists.txt"
+  "/root/repo/test/function/gds/CMakeLists.txt"
+  "/root/repo/test/graph_test/CMakeLists.txt"
+  "/root/repo/test/gtest/CMakeLists.txt"
+  "/root/repo/test/main/CMakeLists.txt"
+  "/root/repo/test/optimizer/CMakeLists.txt"
+  "/root/repo/test/runner/CMakeLists.txt"
+  "/root/repo/test/storage/CMakeLists.txt"
+  "/root/repo/test/test_helper/CMakeLists.txt"
+  "/root/repo/test/test_runner/CMakeLists.txt"
+  "/root/repo/test/transaction/CMakeLists.txt"
+  "/root/repo/test/util_tests/CMakeLists.txt"
+  "/root/repo/third_party/CMakeLists.txt"
+  "/root/repo/third_party/alp/CMakeLists.txt"
+  "/root/repo/third_party/antlr4_cypher/CMakeLists.txt"
+  "/root/repo/third_party/antlr4_runtime/CMakeLists.txt"
+  "/root/repo/third_party/brotli/CMakeLists.txt"
+  "/root/repo/third_party/fast_float/CMakeLists.txt"
+  "/root/repo/third_party/fastpfor/CMakeLists.txt"
+  "/root/repo/third_party/glob/CMakeLists.txt"
+  "/root/repo/third_party/lz4/CMakeLists.txt"
+  "/root/repo/third_party/mbedtls/CMakeLists.txt"
+  "/root/repo/third_party/miniparquet/CMakeLists.txt"
+  "/root/repo/third_party/miniz/CMakeLists.txt"
+  "/root/repo/third_party/re2/CMakeLists.txt"
+  "/root/repo/third_party/serd/CMakeLists.txt"
+  "/root/repo/third_party/utf8proc/CMakeLists.txt"
+  "/root/repo/third_party/zstd/CMakeLists.txt"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tools/shell/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/src/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/CMakeLists.txt"
+  "/usr/src/googletest/googlemock/cmake/gmock.pc.in"
+  "/usr/src/googletest/googlemock/cmake/gmock_main.pc.in"
+  "/usr/src/googletest/googletest/CMakeLists.txt"
+  "/usr/src/googletest/googletest/cmake/Config.cmake.in"
+  "/usr/src/googletest/googletest/cmake/gtest.pc.in"
+  "/usr/src/googletest/googletest/cmake/gtest_main.pc.in"
+  "/usr/src/googletest/googletest/cmake/internal_utils.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/antlr4_cypher/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/antlr4_runtime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/brotli/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/fast_float/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/alp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/fastpfor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/glob/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/mbedtls/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/miniparquet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/miniz/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/re2/DartConfiguration.tcl"
+  "third_party/re2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/serd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/utf8proc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/zstd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "third_party/lz4/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/bind/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/bind/copy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/bind/ddl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/bind/read/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/bind_expression/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/ddl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/expression/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/query/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/rewriter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/binder/visitor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/c_api/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/catalog/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/catalog/catalog_entry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/arrow/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/copier_config/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/data_chunk/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/enums/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/exception/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/serializer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/signal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/task_system/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/types/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/types/value/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/vector/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/file_system/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/expression_evaluator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/aggregate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/arithmetic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/array/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/cast/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/date/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/gds/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/list/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/map/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/path/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/pattern/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/sequence/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/struct/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/table/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/table/call/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/union/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/utility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/string/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/function/export/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/graph/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/main/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/optimizer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/parser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/parser/antlr_parser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/parser/expression/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/parser/transform/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/parser/visitor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/planner/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/planner/join_order/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/planner/operator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/planner/operator/ddl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/planner/operator/extend/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/planner/operator/factorization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/planner/operator/persistent/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/planner/operator/scan/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/planner/operator/simple/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/planner/plan/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/map/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/aggregate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/ddl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/hash_join/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/intersect/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/order_by/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/persistent/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/persistent/reader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/persistent/reader/csv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/persistent/reader/npy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/persistent/reader/parquet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/persistent/reader/rdf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/persistent/writer/parquet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/scan/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/simple/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/table_scan/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/recursive_extend/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/operator/macro/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/processor/result/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/buffer_manager/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/compression/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/local_storage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/predicate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/index/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/stats/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/storage_structure/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/store/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/storage/wal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/transaction/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/extension/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/gtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/gmock.pc"
+  "_deps/googletest-build/googletest/generated/gmock_main.pc"
+  "_deps/googletest-build/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfigVersion.cmake"
+  "_deps/googletest-build/googletest/generated/GTestConfig.cmake"
+  "_deps/googletest-build/googletest/generated/gtest.pc"
+  "_deps/googletest-build/googletest/generated/gtest_main.pc"
+  "_deps/googletest-build/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/test_helper/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/test_runner/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/graph_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/c_api/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/common/types_test[1]_include.cmake"
+  "test/common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/main/transaction_test[1]_include.cmake"
+  "test/main/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/optimizer/optimizer_test[1]_include.cmake"
+  "test/optimizer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/runner/e2e_test[1]_include.cmake"
+  "test/runner/cleanup_test[1]_include.cmake"
+  "test/runner/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/storage/node_insertion_deletion_test[1]_include.cmake"
+  "test/storage/compression_test[1]_include.cmake"
+  "test/storage/column_chunk_metadata_test[1]_include.cmake"
+  "test/storage/local_hash_index_test[1]_include.cmake"
+  "test/storage/buffer_manager_test[1]_include.cmake"
+  "test/storage/rel_scan_test[1]_include.cmake"
+  "test/storage/node_update_test[1]_include.cmake"
+  "test/storage/local_node_commit_test[1]_include.cmake"
+  "test/storage/chunked_node_group_append_test[1]_include.cmake"
+  "test/storage/csr_packed_density_test[1]_include.cmake"
+  "test/storage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/transaction/current_time_test[1]_include.cmake"
+  "test/transaction/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/util_tests/utils_test[1]_include.cmake"
+  "test/util_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/copy/copy_tests[1]_include.cmake"
+  "test/copy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/function/gds/gds_utils_test[1]_include.cmake"
+  "test/function/gds/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/shell/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "extension/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "third_party/antlr4_cypher/CMakeFiles/antlr4_cypher.dir/DependInfo.cmake"
+  "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/DependInfo.cmake"
+  "third_party/brotli/CMakeFiles/brotlicommon.dir/DependInfo.cmake"
+  "third_party/brotli/CMakeFiles/brotlidec.dir/DependInfo.cmake"
+  "third_party/brotli/CMakeFiles/brotlienc.dir/DependInfo.cmake"
+  "third_party/fastpfor/CMakeFiles/fastpfor.dir/DependInfo.cmake"
+  "third_party/mbedtls/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "third_party/miniparquet/CMakeFiles/miniparquet.dir/DependInfo.cmake"
+  "third_party/miniz/CMakeFiles/miniz.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "third_party/re2/CMakeFiles/re2.dir/DependInfo.cmake"
+  "third_party/serd/CMakeFiles/serd.dir/DependInfo.cmake"
+  "third_party/utf8proc/CMakeFiles/utf8proc.dir/DependInfo.cmake"
+  "third_party/zstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "third_party/lz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  "src/CMakeFiles/kuzu.dir/DependInfo.cmake"
+  "src/CMakeFiles/kuzu_shared.dir/DependInfo.cmake"
+  "src/CMakeFiles/single_file_header.dir/DependInfo.cmake"
+  "src/binder/CMakeFiles/kuzu_binder.dir/DependInfo.cmake"
+  "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/DependInfo.cmake"
+  "src/binder/bind/copy/CMakeFiles/kuzu_binder_bind_copy.dir/DependInfo.cmake"
+  "src/binder/bind/ddl/CMakeFiles/kuzu_binder_bind_ddl.dir/DependInfo.cmake"
+  "src/binder/bind/read/CMakeFiles/kuzu_binder_bind_read.dir/DependInfo.cmake"
+  "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/DependInfo.cmake"
+  "src/binder/ddl/CMakeFiles/kuzu_binder_ddl.dir/DependInfo.cmake"
+  "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/DependInfo.cmake"
+  "src/binder/query/CMakeFiles/kuzu_binder_query.dir/DependInfo.cmake"
+  "src/binder/rewriter/CMakeFiles/kuzu_binder_rewriter.dir/DependInfo.cmake"
+  "src/binder/visitor/CMakeFiles/kuzu_binder_visitor.dir/DependInfo.cmake"
+  "src/c_api/CMakeFiles/kuzu_c_api.dir/DependInfo.cmake"
+  "src/catalog/CMakeFiles/kuzu_catalog.dir/DependInfo.cmake"
+  "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/DependInfo.cmake"
+  "src/common/CMakeFiles/kuzu_common.dir/DependInfo.cmake"
+  "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/DependInfo.cmake"
+  "src/common/copier_config/CMakeFiles/kuzu_common_copier_config.dir/DependInfo.cmake"
+  "src/common/data_chunk/CMakeFiles/kuzu_common_data_chunk.dir/DependInfo.cmake"
+  "src/common/enums/CMakeFiles/kuzu_common_enums.dir/DependInfo.cmake"
+  "src/common/exception/CMakeFiles/kuzu_common_exception.dir/DependInfo.cmake"
+  "src/common/serializer/CMakeFiles/kuzu_common_serializer.dir/DependInfo.cmake"
+  "src/common/task_system/CMakeFiles/kuzu_common_task_system.dir/DependInfo.cmake"
+  "src/common/types/CMakeFiles/kuzu_common_types.dir/DependInfo.cmake"
+  "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/DependInfo.cmake"
+  "src/common/vector/CMakeFiles/kuzu_common_vector.dir/DependInfo.cmake"
+  "src/common/file_system/CMakeFiles/kuzu_file_system.dir/DependInfo.cmake"
+  "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/DependInfo.cmake"
+  "src/function/CMakeFiles/kuzu_function.dir/DependInfo.cmake"
+  "src/function/aggregate/CMakeFiles/kuzu_function_aggregate.dir/DependInfo.cmake"
+  "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/DependInfo.cmake"
+  "src/function/array/CMakeFiles/kuzu_function_array.dir/DependInfo.cmake"
+  "src/function/cast/CMakeFiles/kuzu_function_cast.dir/DependInfo.cmake"
+  "src/function/date/CMakeFiles/kuzu_function_date.dir/DependInfo.cmake"
+  "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/DependInfo.cmake"
+  "src/function/list/CMakeFiles/kuzu_list_function.dir/DependInfo.cmake"
+  "src/function/map/CMakeFiles/kuzu_function_map.dir/DependInfo.cmake"
+  "src/function/path/CMakeFiles/kuzu_function_path.dir/DependInfo.cmake"
+  "src/function/pattern/CMakeFiles/kuzu_function_pattern.dir/DependInfo.cmake"
+  "src/function/sequence/CMakeFiles/kuzu_function_sequence.dir/DependInfo.cmake"
+  "src/function/struct/CMakeFiles/kuzu_function_struct.dir/DependInfo.cmake"
+  "src/function/table/CMakeFiles/kuzu_table.dir/DependInfo.cmake"
+  "src/function/table/call/CMakeFiles/kuzu_table_call.dir/DependInfo.cmake"
+  "src/function/union/CMakeFiles/kuzu_function_union.dir/DependInfo.cmake"
+  "src/function/utility/CMakeFiles/kuzu_utility_function.dir/DependInfo.cmake"
+  "src/function/string/CMakeFiles/kuzu_string_function.dir/DependInfo.cmake"
+  "src/function/export/CMakeFiles/kuzu_function_export.dir/DependInfo.cmake"
+  "src/graph/CMakeFiles/kuzu_graph.dir/DependInfo.cmake"
+  "src/main/CMakeFiles/kuzu_main.dir/DependInfo.cmake"
+  "src/optimizer/CMakeFiles/kuzu_optimizer.dir/DependInfo.cmake"
+  "src/parser/CMakeFiles/kuzu_parser.dir/DependInfo.cmake"
+  "src/parser/antlr_parser/CMakeFiles/kuzu_parser_antlr_parser.dir/DependInfo.cmake"
+  "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/DependInfo.cmake"
+  "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/DependInfo.cmake"
+  "src/parser/visitor/CMakeFiles/kuzu_parser_visitor.dir/DependInfo.cmake"
+  "src/planner/CMakeFiles/kuzu_planner.dir/DependInfo.cmake"
+  "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/DependInfo.cmake"
+  "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/DependInfo.cmake"
+  "src/planner/operator/ddl/CMakeFiles/kuzu_planner_ddl.dir/DependInfo.cmake"
+  "src/planner/operator/extend/CMakeFiles/kuzu_planner_extend.dir/DependInfo.cmake"
+  "src/planner/operator/factorization/CMakeFiles/kuzu_planner_factorization.dir/DependInfo.cmake"
+  "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/DependInfo.cmake"
+  "src/planner/operator/scan/CMakeFiles/kuzu_planner_scan.dir/DependInfo.cmake"
+  "src/planner/operator/simple/CMakeFiles/kuzu_planner_simple.dir/DependInfo.cmake"
+  "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/DependInfo.cmake"
+  "src/processor/CMakeFiles/kuzu_processor.dir/DependInfo.cmake"
+  "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/DependInfo.cmake"
+  "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/DependInfo.cmake"
+  "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/DependInfo.cmake"
+  "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/DependInfo.cmake"
+  "src/processor/operator/hash_join/CMakeFiles/kuzu_processor_operator_hash_join.dir/DependInfo.cmake"
+  "src/processor/operator/intersect/CMakeFiles/kuzu_processor_operator_intersect.dir/DependInfo.cmake"
+  "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/DependInfo.cmake"
+  "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/DependInfo.cmake"
+  "src/processor/operator/persistent/reader/CMakeFiles/kuzu_processor_operator_persistent_reader.dir/DependInfo.cmake"
+  "src/processor/operator/persistent/reader/csv/CMakeFiles/kuzu_processor_operator_csv_reader.dir/DependInfo.cmake"
+  "src/processor/operator/persistent/reader/npy/CMakeFiles/kuzu_processor_operator_npy_reader.dir/DependInfo.cmake"
+  "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/DependInfo.cmake"
+  "src/processor/operator/persistent/reader/rdf/CMakeFiles/kuzu_processor_operator_rdf_reader.dir/DependInfo.cmake"
+  "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/DependInfo.cmake"
+  "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/DependInfo.cmake"
+  "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/DependInfo.cmake"
+  "src/processor/operator/table_scan/CMakeFiles/kuzu_processor_operator_table_scan.dir/DependInfo.cmake"
+  "src/processor/operator/recursive_extend/CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/DependInfo.cmake"
+  "src/processor/operator/macro/CMakeFiles/kuzu_processor_operator_create_macro.dir/DependInfo.cmake"
+  "src/processor/result/CMakeFiles/kuzu_processor_result.dir/DependInfo.cmake"
+  "src/storage/CMakeFiles/kuzu_storage.dir/DependInfo.cmake"
+  "src/storage/buffer_manager/CMakeFiles/kuzu_storage_buffer_manager.dir/DependInfo.cmake"
+  "src/storage/compression/CMakeFiles/kuzu_storage_compression.dir/DependInfo.cmake"
+  "src/storage/local_storage/CMakeFiles/kuzu_storage_local_storage.dir/DependInfo.cmake"
+  "src/storage/predicate/CMakeFiles/kuzu_storage_predicate.dir/DependInfo.cmake"
+  "src/storage/index/CMakeFiles/kuzu_storage_index.dir/DependInfo.cmake"
+  "src/storage/stats/CMakeFiles/kuzu_storage_stats.dir/DependInfo.cmake"
+  "src/storage/storage_structure/CMakeFiles/kuzu_storage_structure.dir/DependInfo.cmake"
+  "src/storage/store/CMakeFiles/kuzu_storage_store.dir/DependInfo.cmake"
+  "src/storage/wal/CMakeFiles/kuzu_storage_wal.dir/DependInfo.cmake"
+  "src/transaction/CMakeFiles/kuzu_transaction.dir/DependInfo.cmake"
+  "src/extension/CMakeFiles/kuzu_extension.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "_deps/googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "test/test_helper/CMakeFiles/test_helper.dir/DependInfo.cmake"
+  "test/test_helper/CMakeFiles/api_test_helper.dir/DependInfo.cmake"
+  "test/test_runner/CMakeFiles/test_runner.dir/DependInfo.cmake"
+  "test/graph_test/CMakeFiles/graph_test.dir/DependInfo.cmake"
+  "test/graph_test/CMakeFiles/api_graph_test.dir/DependInfo.cmake"
+  "test/c_api/CMakeFiles/c_api_test.dir/DependInfo.cmake"
+  "test/common/CMakeFiles/types_test.dir/DependInfo.cmake"
+  "test/main/CMakeFiles/main_test.dir/DependInfo.cmake"
+  "test/main/CMakeFiles/transaction_test.dir/DependInfo.cmake"
+  "test/optimizer/CMakeFiles/optimizer_test.dir/DependInfo.cmake"
+  "test/runner/CMakeFiles/e2e_test.dir/DependInfo.cmake"
+  "test/runner/CMakeFiles/cleanup_test.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/node_insertion_deletion_test.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/compression_test.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/column_chunk_metadata_test.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/local_hash_index_test.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/buffer_manager_test.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/rel_scan_test.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/node_update_test.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/local_node_commit_test.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/chunked_node_group_append_test.dir/DependInfo.cmake"
+  "test/storage/CMakeFiles/csr_packed_density_test.dir/DependInfo.cmake"
+  "test/transaction/CMakeFiles/current_time_test.dir/DependInfo.cmake"
+  "test/util_tests/CMakeFiles/utils_test.dir/DependInfo.cmake"
+  "test/copy/CMakeFiles/copy_tests.dir/DependInfo.cmake"
+  "test/function/gds/CMakeFiles/gds_utils_test.dir/DependInfo.cmake"
+  "tools/shell/CMakeFiles/kuzu_shell.dir/DependInfo.cmake"
+  )
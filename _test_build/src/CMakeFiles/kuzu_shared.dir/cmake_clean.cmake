@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libkuzu.pdb"
+  "libkuzu.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/single_file_header"
+  "kuzu.hpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/single_file_header.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
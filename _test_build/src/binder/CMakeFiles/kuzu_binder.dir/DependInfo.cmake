@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/binder/binder.cpp" "src/binder/CMakeFiles/kuzu_binder.dir/binder.cpp.o" "gcc" "src/binder/CMakeFiles/kuzu_binder.dir/binder.cpp.o.d"
+  "/root/repo/src/binder/binder_scope.cpp" "src/binder/CMakeFiles/kuzu_binder.dir/binder_scope.cpp.o" "gcc" "src/binder/CMakeFiles/kuzu_binder.dir/binder_scope.cpp.o.d"
+  "/root/repo/src/binder/bound_scan_source.cpp" "src/binder/CMakeFiles/kuzu_binder.dir/bound_scan_source.cpp.o" "gcc" "src/binder/CMakeFiles/kuzu_binder.dir/bound_scan_source.cpp.o.d"
+  "/root/repo/src/binder/bound_statement_result.cpp" "src/binder/CMakeFiles/kuzu_binder.dir/bound_statement_result.cpp.o" "gcc" "src/binder/CMakeFiles/kuzu_binder.dir/bound_statement_result.cpp.o.d"
+  "/root/repo/src/binder/bound_statement_rewriter.cpp" "src/binder/CMakeFiles/kuzu_binder.dir/bound_statement_rewriter.cpp.o" "gcc" "src/binder/CMakeFiles/kuzu_binder.dir/bound_statement_rewriter.cpp.o.d"
+  "/root/repo/src/binder/bound_statement_visitor.cpp" "src/binder/CMakeFiles/kuzu_binder.dir/bound_statement_visitor.cpp.o" "gcc" "src/binder/CMakeFiles/kuzu_binder.dir/bound_statement_visitor.cpp.o.d"
+  "/root/repo/src/binder/expression_binder.cpp" "src/binder/CMakeFiles/kuzu_binder.dir/expression_binder.cpp.o" "gcc" "src/binder/CMakeFiles/kuzu_binder.dir/expression_binder.cpp.o.d"
+  "/root/repo/src/binder/expression_visitor.cpp" "src/binder/CMakeFiles/kuzu_binder.dir/expression_visitor.cpp.o" "gcc" "src/binder/CMakeFiles/kuzu_binder.dir/expression_visitor.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder.dir/binder.cpp.o"
+  "CMakeFiles/kuzu_binder.dir/binder.cpp.o.d"
+  "CMakeFiles/kuzu_binder.dir/binder_scope.cpp.o"
+  "CMakeFiles/kuzu_binder.dir/binder_scope.cpp.o.d"
+  "CMakeFiles/kuzu_binder.dir/bound_scan_source.cpp.o"
+  "CMakeFiles/kuzu_binder.dir/bound_scan_source.cpp.o.d"
+  "CMakeFiles/kuzu_binder.dir/bound_statement_result.cpp.o"
+  "CMakeFiles/kuzu_binder.dir/bound_statement_result.cpp.o.d"
+  "CMakeFiles/kuzu_binder.dir/bound_statement_rewriter.cpp.o"
+  "CMakeFiles/kuzu_binder.dir/bound_statement_rewriter.cpp.o.d"
+  "CMakeFiles/kuzu_binder.dir/bound_statement_visitor.cpp.o"
+  "CMakeFiles/kuzu_binder.dir/bound_statement_visitor.cpp.o.d"
+  "CMakeFiles/kuzu_binder.dir/expression_binder.cpp.o"
+  "CMakeFiles/kuzu_binder.dir/expression_binder.cpp.o.d"
+  "CMakeFiles/kuzu_binder.dir/expression_visitor.cpp.o"
+  "CMakeFiles/kuzu_binder.dir/expression_visitor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
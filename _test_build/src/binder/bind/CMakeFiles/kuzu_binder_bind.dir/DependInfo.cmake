@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/binder/bind/bind_attach_database.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_attach_database.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_attach_database.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_create_macro.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_create_macro.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_create_macro.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_ddl.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_ddl.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_ddl.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_detach_database.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_detach_database.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_detach_database.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_explain.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_explain.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_explain.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_export_database.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_export_database.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_export_database.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_extension.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_extension.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_extension.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_file_scan.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_file_scan.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_file_scan.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_graph_pattern.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_graph_pattern.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_graph_pattern.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_import_database.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_import_database.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_import_database.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_project_graph.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_project_graph.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_project_graph.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_projection_clause.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_projection_clause.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_projection_clause.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_query.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_query.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_query.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_reading_clause.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_reading_clause.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_reading_clause.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_standalone_call.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_standalone_call.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_standalone_call.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_transaction.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_transaction.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_transaction.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_updating_clause.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_updating_clause.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_updating_clause.cpp.o.d"
+  "/root/repo/src/binder/bind/bind_use_database.cpp" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_use_database.cpp.o" "gcc" "src/binder/bind/CMakeFiles/kuzu_binder_bind.dir/bind_use_database.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder_bind.dir/bind_attach_database.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_attach_database.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_create_macro.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_create_macro.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_ddl.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_ddl.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_detach_database.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_detach_database.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_explain.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_explain.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_export_database.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_export_database.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_extension.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_extension.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_file_scan.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_file_scan.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_graph_pattern.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_graph_pattern.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_import_database.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_import_database.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_project_graph.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_project_graph.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_projection_clause.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_projection_clause.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_query.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_query.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_reading_clause.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_reading_clause.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_standalone_call.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_standalone_call.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_transaction.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_transaction.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_updating_clause.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_updating_clause.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_use_database.cpp.o"
+  "CMakeFiles/kuzu_binder_bind.dir/bind_use_database.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder_bind.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
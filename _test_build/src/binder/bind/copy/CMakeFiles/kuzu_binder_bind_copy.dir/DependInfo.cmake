@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/binder/bind/copy/bind_copy_from.cpp" "src/binder/bind/copy/CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_from.cpp.o" "gcc" "src/binder/bind/copy/CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_from.cpp.o.d"
+  "/root/repo/src/binder/bind/copy/bind_copy_rdf_graph.cpp" "src/binder/bind/copy/CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_rdf_graph.cpp.o" "gcc" "src/binder/bind/copy/CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_rdf_graph.cpp.o.d"
+  "/root/repo/src/binder/bind/copy/bind_copy_to.cpp" "src/binder/bind/copy/CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_to.cpp.o" "gcc" "src/binder/bind/copy/CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_to.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_from.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_from.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_rdf_graph.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_rdf_graph.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_to.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_copy.dir/bind_copy_to.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder_bind_copy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
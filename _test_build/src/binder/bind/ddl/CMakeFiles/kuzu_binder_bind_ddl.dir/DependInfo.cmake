@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/binder/bind/ddl/bind_create_rdf_graph.cpp" "src/binder/bind/ddl/CMakeFiles/kuzu_binder_bind_ddl.dir/bind_create_rdf_graph.cpp.o" "gcc" "src/binder/bind/ddl/CMakeFiles/kuzu_binder_bind_ddl.dir/bind_create_rdf_graph.cpp.o.d"
+  "/root/repo/src/binder/bind/ddl/bound_create_table_info.cpp" "src/binder/bind/ddl/CMakeFiles/kuzu_binder_bind_ddl.dir/bound_create_table_info.cpp.o" "gcc" "src/binder/bind/ddl/CMakeFiles/kuzu_binder_bind_ddl.dir/bound_create_table_info.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder_bind_ddl.dir/bind_create_rdf_graph.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_ddl.dir/bind_create_rdf_graph.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_ddl.dir/bound_create_table_info.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_ddl.dir/bound_create_table_info.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder_bind_ddl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/binder/bind/read/bind_in_query_call.cpp" "src/binder/bind/read/CMakeFiles/kuzu_binder_bind_read.dir/bind_in_query_call.cpp.o" "gcc" "src/binder/bind/read/CMakeFiles/kuzu_binder_bind_read.dir/bind_in_query_call.cpp.o.d"
+  "/root/repo/src/binder/bind/read/bind_load_from.cpp" "src/binder/bind/read/CMakeFiles/kuzu_binder_bind_read.dir/bind_load_from.cpp.o" "gcc" "src/binder/bind/read/CMakeFiles/kuzu_binder_bind_read.dir/bind_load_from.cpp.o.d"
+  "/root/repo/src/binder/bind/read/bind_match.cpp" "src/binder/bind/read/CMakeFiles/kuzu_binder_bind_read.dir/bind_match.cpp.o" "gcc" "src/binder/bind/read/CMakeFiles/kuzu_binder_bind_read.dir/bind_match.cpp.o.d"
+  "/root/repo/src/binder/bind/read/bind_unwind.cpp" "src/binder/bind/read/CMakeFiles/kuzu_binder_bind_read.dir/bind_unwind.cpp.o" "gcc" "src/binder/bind/read/CMakeFiles/kuzu_binder_bind_read.dir/bind_unwind.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
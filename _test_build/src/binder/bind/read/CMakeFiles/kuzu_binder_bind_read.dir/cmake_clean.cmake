@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder_bind_read.dir/bind_in_query_call.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_read.dir/bind_in_query_call.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_read.dir/bind_load_from.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_read.dir/bind_load_from.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_read.dir/bind_match.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_read.dir/bind_match.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_read.dir/bind_unwind.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_read.dir/bind_unwind.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder_bind_read.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
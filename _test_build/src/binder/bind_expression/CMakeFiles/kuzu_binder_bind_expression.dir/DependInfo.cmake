@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/binder/bind_expression/bind_boolean_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_boolean_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_boolean_expression.cpp.o.d"
+  "/root/repo/src/binder/bind_expression/bind_case_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_case_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_case_expression.cpp.o.d"
+  "/root/repo/src/binder/bind_expression/bind_comparison_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_comparison_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_comparison_expression.cpp.o.d"
+  "/root/repo/src/binder/bind_expression/bind_function_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_function_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_function_expression.cpp.o.d"
+  "/root/repo/src/binder/bind_expression/bind_lambda_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_lambda_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_lambda_expression.cpp.o.d"
+  "/root/repo/src/binder/bind_expression/bind_literal_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_literal_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_literal_expression.cpp.o.d"
+  "/root/repo/src/binder/bind_expression/bind_null_operator_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_null_operator_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_null_operator_expression.cpp.o.d"
+  "/root/repo/src/binder/bind_expression/bind_parameter_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_parameter_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_parameter_expression.cpp.o.d"
+  "/root/repo/src/binder/bind_expression/bind_property_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_property_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_property_expression.cpp.o.d"
+  "/root/repo/src/binder/bind_expression/bind_subquery_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_subquery_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_subquery_expression.cpp.o.d"
+  "/root/repo/src/binder/bind_expression/bind_variable_expression.cpp" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_variable_expression.cpp.o" "gcc" "src/binder/bind_expression/CMakeFiles/kuzu_binder_bind_expression.dir/bind_variable_expression.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
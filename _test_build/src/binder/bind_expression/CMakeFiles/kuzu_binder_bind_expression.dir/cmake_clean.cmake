@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_boolean_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_boolean_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_case_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_case_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_comparison_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_comparison_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_function_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_function_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_lambda_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_lambda_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_literal_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_literal_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_null_operator_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_null_operator_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_parameter_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_parameter_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_property_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_property_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_subquery_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_subquery_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_variable_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_bind_expression.dir/bind_variable_expression.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder_bind_expression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder_ddl.dir/property_definition.cpp.o"
+  "CMakeFiles/kuzu_binder_ddl.dir/property_definition.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder_ddl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/binder/expression/aggregate_function_expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/aggregate_function_expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/aggregate_function_expression.cpp.o.d"
+  "/root/repo/src/binder/expression/case_expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/case_expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/case_expression.cpp.o.d"
+  "/root/repo/src/binder/expression/expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/expression.cpp.o.d"
+  "/root/repo/src/binder/expression/expression_util.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/expression_util.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/expression_util.cpp.o.d"
+  "/root/repo/src/binder/expression/literal_expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/literal_expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/literal_expression.cpp.o.d"
+  "/root/repo/src/binder/expression/node_expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/node_expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/node_expression.cpp.o.d"
+  "/root/repo/src/binder/expression/node_rel_expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/node_rel_expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/node_rel_expression.cpp.o.d"
+  "/root/repo/src/binder/expression/parameter_expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/parameter_expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/parameter_expression.cpp.o.d"
+  "/root/repo/src/binder/expression/property_expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/property_expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/property_expression.cpp.o.d"
+  "/root/repo/src/binder/expression/rel_expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/rel_expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/rel_expression.cpp.o.d"
+  "/root/repo/src/binder/expression/scalar_function_expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/scalar_function_expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/scalar_function_expression.cpp.o.d"
+  "/root/repo/src/binder/expression/variable_expression.cpp" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/variable_expression.cpp.o" "gcc" "src/binder/expression/CMakeFiles/kuzu_binder_expression.dir/variable_expression.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
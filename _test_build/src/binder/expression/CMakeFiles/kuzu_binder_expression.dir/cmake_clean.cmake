@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder_expression.dir/aggregate_function_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/aggregate_function_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/case_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/case_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/expression_util.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/expression_util.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/literal_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/literal_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/node_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/node_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/node_rel_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/node_rel_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/parameter_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/parameter_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/property_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/property_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/rel_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/rel_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/scalar_function_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/scalar_function_expression.cpp.o.d"
+  "CMakeFiles/kuzu_binder_expression.dir/variable_expression.cpp.o"
+  "CMakeFiles/kuzu_binder_expression.dir/variable_expression.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder_expression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
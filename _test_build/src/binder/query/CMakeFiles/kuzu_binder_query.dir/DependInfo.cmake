@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/binder/query/bound_delete_clause.cpp" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/bound_delete_clause.cpp.o" "gcc" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/bound_delete_clause.cpp.o.d"
+  "/root/repo/src/binder/query/bound_gds_call.cpp" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/bound_gds_call.cpp.o" "gcc" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/bound_gds_call.cpp.o.d"
+  "/root/repo/src/binder/query/bound_insert_clause.cpp" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/bound_insert_clause.cpp.o" "gcc" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/bound_insert_clause.cpp.o.d"
+  "/root/repo/src/binder/query/bound_merge_clause.cpp" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/bound_merge_clause.cpp.o" "gcc" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/bound_merge_clause.cpp.o.d"
+  "/root/repo/src/binder/query/bound_set_clause.cpp" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/bound_set_clause.cpp.o" "gcc" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/bound_set_clause.cpp.o.d"
+  "/root/repo/src/binder/query/query_graph.cpp" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/query_graph.cpp.o" "gcc" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/query_graph.cpp.o.d"
+  "/root/repo/src/binder/query/query_graph_label_analyzer.cpp" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/query_graph_label_analyzer.cpp.o" "gcc" "src/binder/query/CMakeFiles/kuzu_binder_query.dir/query_graph_label_analyzer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
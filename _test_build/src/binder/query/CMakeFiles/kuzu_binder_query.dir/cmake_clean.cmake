@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder_query.dir/bound_delete_clause.cpp.o"
+  "CMakeFiles/kuzu_binder_query.dir/bound_delete_clause.cpp.o.d"
+  "CMakeFiles/kuzu_binder_query.dir/bound_gds_call.cpp.o"
+  "CMakeFiles/kuzu_binder_query.dir/bound_gds_call.cpp.o.d"
+  "CMakeFiles/kuzu_binder_query.dir/bound_insert_clause.cpp.o"
+  "CMakeFiles/kuzu_binder_query.dir/bound_insert_clause.cpp.o.d"
+  "CMakeFiles/kuzu_binder_query.dir/bound_merge_clause.cpp.o"
+  "CMakeFiles/kuzu_binder_query.dir/bound_merge_clause.cpp.o.d"
+  "CMakeFiles/kuzu_binder_query.dir/bound_set_clause.cpp.o"
+  "CMakeFiles/kuzu_binder_query.dir/bound_set_clause.cpp.o.d"
+  "CMakeFiles/kuzu_binder_query.dir/query_graph.cpp.o"
+  "CMakeFiles/kuzu_binder_query.dir/query_graph.cpp.o.d"
+  "CMakeFiles/kuzu_binder_query.dir/query_graph_label_analyzer.cpp.o"
+  "CMakeFiles/kuzu_binder_query.dir/query_graph_label_analyzer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder_query.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
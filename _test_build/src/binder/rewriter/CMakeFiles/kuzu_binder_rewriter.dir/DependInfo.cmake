@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/binder/rewriter/match_clause_pattern_label_rewriter.cpp" "src/binder/rewriter/CMakeFiles/kuzu_binder_rewriter.dir/match_clause_pattern_label_rewriter.cpp.o" "gcc" "src/binder/rewriter/CMakeFiles/kuzu_binder_rewriter.dir/match_clause_pattern_label_rewriter.cpp.o.d"
+  "/root/repo/src/binder/rewriter/with_clause_projection_rewriter.cpp" "src/binder/rewriter/CMakeFiles/kuzu_binder_rewriter.dir/with_clause_projection_rewriter.cpp.o" "gcc" "src/binder/rewriter/CMakeFiles/kuzu_binder_rewriter.dir/with_clause_projection_rewriter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
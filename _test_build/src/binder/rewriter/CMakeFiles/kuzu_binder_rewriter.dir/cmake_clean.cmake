@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder_rewriter.dir/match_clause_pattern_label_rewriter.cpp.o"
+  "CMakeFiles/kuzu_binder_rewriter.dir/match_clause_pattern_label_rewriter.cpp.o.d"
+  "CMakeFiles/kuzu_binder_rewriter.dir/with_clause_projection_rewriter.cpp.o"
+  "CMakeFiles/kuzu_binder_rewriter.dir/with_clause_projection_rewriter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder_rewriter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/binder/visitor/default_type_solver.cpp" "src/binder/visitor/CMakeFiles/kuzu_binder_visitor.dir/default_type_solver.cpp.o" "gcc" "src/binder/visitor/CMakeFiles/kuzu_binder_visitor.dir/default_type_solver.cpp.o.d"
+  "/root/repo/src/binder/visitor/property_collector.cpp" "src/binder/visitor/CMakeFiles/kuzu_binder_visitor.dir/property_collector.cpp.o" "gcc" "src/binder/visitor/CMakeFiles/kuzu_binder_visitor.dir/property_collector.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_binder_visitor.dir/default_type_solver.cpp.o"
+  "CMakeFiles/kuzu_binder_visitor.dir/default_type_solver.cpp.o.d"
+  "CMakeFiles/kuzu_binder_visitor.dir/property_collector.cpp.o"
+  "CMakeFiles/kuzu_binder_visitor.dir/property_collector.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_binder_visitor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
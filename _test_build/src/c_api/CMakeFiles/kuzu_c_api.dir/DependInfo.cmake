@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/c_api/connection.cpp" "src/c_api/CMakeFiles/kuzu_c_api.dir/connection.cpp.o" "gcc" "src/c_api/CMakeFiles/kuzu_c_api.dir/connection.cpp.o.d"
+  "/root/repo/src/c_api/data_type.cpp" "src/c_api/CMakeFiles/kuzu_c_api.dir/data_type.cpp.o" "gcc" "src/c_api/CMakeFiles/kuzu_c_api.dir/data_type.cpp.o.d"
+  "/root/repo/src/c_api/database.cpp" "src/c_api/CMakeFiles/kuzu_c_api.dir/database.cpp.o" "gcc" "src/c_api/CMakeFiles/kuzu_c_api.dir/database.cpp.o.d"
+  "/root/repo/src/c_api/flat_tuple.cpp" "src/c_api/CMakeFiles/kuzu_c_api.dir/flat_tuple.cpp.o" "gcc" "src/c_api/CMakeFiles/kuzu_c_api.dir/flat_tuple.cpp.o.d"
+  "/root/repo/src/c_api/helpers.cpp" "src/c_api/CMakeFiles/kuzu_c_api.dir/helpers.cpp.o" "gcc" "src/c_api/CMakeFiles/kuzu_c_api.dir/helpers.cpp.o.d"
+  "/root/repo/src/c_api/prepared_statement.cpp" "src/c_api/CMakeFiles/kuzu_c_api.dir/prepared_statement.cpp.o" "gcc" "src/c_api/CMakeFiles/kuzu_c_api.dir/prepared_statement.cpp.o.d"
+  "/root/repo/src/c_api/query_result.cpp" "src/c_api/CMakeFiles/kuzu_c_api.dir/query_result.cpp.o" "gcc" "src/c_api/CMakeFiles/kuzu_c_api.dir/query_result.cpp.o.d"
+  "/root/repo/src/c_api/query_summary.cpp" "src/c_api/CMakeFiles/kuzu_c_api.dir/query_summary.cpp.o" "gcc" "src/c_api/CMakeFiles/kuzu_c_api.dir/query_summary.cpp.o.d"
+  "/root/repo/src/c_api/value.cpp" "src/c_api/CMakeFiles/kuzu_c_api.dir/value.cpp.o" "gcc" "src/c_api/CMakeFiles/kuzu_c_api.dir/value.cpp.o.d"
+  "/root/repo/src/c_api/version.cpp" "src/c_api/CMakeFiles/kuzu_c_api.dir/version.cpp.o" "gcc" "src/c_api/CMakeFiles/kuzu_c_api.dir/version.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_c_api.dir/connection.cpp.o"
+  "CMakeFiles/kuzu_c_api.dir/connection.cpp.o.d"
+  "CMakeFiles/kuzu_c_api.dir/data_type.cpp.o"
+  "CMakeFiles/kuzu_c_api.dir/data_type.cpp.o.d"
+  "CMakeFiles/kuzu_c_api.dir/database.cpp.o"
+  "CMakeFiles/kuzu_c_api.dir/database.cpp.o.d"
+  "CMakeFiles/kuzu_c_api.dir/flat_tuple.cpp.o"
+  "CMakeFiles/kuzu_c_api.dir/flat_tuple.cpp.o.d"
+  "CMakeFiles/kuzu_c_api.dir/helpers.cpp.o"
+  "CMakeFiles/kuzu_c_api.dir/helpers.cpp.o.d"
+  "CMakeFiles/kuzu_c_api.dir/prepared_statement.cpp.o"
+  "CMakeFiles/kuzu_c_api.dir/prepared_statement.cpp.o.d"
+  "CMakeFiles/kuzu_c_api.dir/query_result.cpp.o"
+  "CMakeFiles/kuzu_c_api.dir/query_result.cpp.o.d"
+  "CMakeFiles/kuzu_c_api.dir/query_summary.cpp.o"
+  "CMakeFiles/kuzu_c_api.dir/query_summary.cpp.o.d"
+  "CMakeFiles/kuzu_c_api.dir/value.cpp.o"
+  "CMakeFiles/kuzu_c_api.dir/value.cpp.o.d"
+  "CMakeFiles/kuzu_c_api.dir/version.cpp.o"
+  "CMakeFiles/kuzu_c_api.dir/version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_c_api.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/catalog/catalog.cpp" "src/catalog/CMakeFiles/kuzu_catalog.dir/catalog.cpp.o" "gcc" "src/catalog/CMakeFiles/kuzu_catalog.dir/catalog.cpp.o.d"
+  "/root/repo/src/catalog/catalog_set.cpp" "src/catalog/CMakeFiles/kuzu_catalog.dir/catalog_set.cpp.o" "gcc" "src/catalog/CMakeFiles/kuzu_catalog.dir/catalog_set.cpp.o.d"
+  "/root/repo/src/catalog/property_definition_collection.cpp" "src/catalog/CMakeFiles/kuzu_catalog.dir/property_definition_collection.cpp.o" "gcc" "src/catalog/CMakeFiles/kuzu_catalog.dir/property_definition_collection.cpp.o.d"
+  "/root/repo/src/catalog/table_statistics.cpp" "src/catalog/CMakeFiles/kuzu_catalog.dir/table_statistics.cpp.o" "gcc" "src/catalog/CMakeFiles/kuzu_catalog.dir/table_statistics.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_catalog.dir/catalog.cpp.o"
+  "CMakeFiles/kuzu_catalog.dir/catalog.cpp.o.d"
+  "CMakeFiles/kuzu_catalog.dir/catalog_set.cpp.o"
+  "CMakeFiles/kuzu_catalog.dir/catalog_set.cpp.o.d"
+  "CMakeFiles/kuzu_catalog.dir/property_definition_collection.cpp.o"
+  "CMakeFiles/kuzu_catalog.dir/property_definition_collection.cpp.o.d"
+  "CMakeFiles/kuzu_catalog.dir/table_statistics.cpp.o"
+  "CMakeFiles/kuzu_catalog.dir/table_statistics.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_catalog.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/catalog/catalog_entry/catalog_entry.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/catalog_entry.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/catalog_entry.cpp.o.d"
+  "/root/repo/src/catalog/catalog_entry/catalog_entry_type.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/catalog_entry_type.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/catalog_entry_type.cpp.o.d"
+  "/root/repo/src/catalog/catalog_entry/function_catalog_entry.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/function_catalog_entry.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/function_catalog_entry.cpp.o.d"
+  "/root/repo/src/catalog/catalog_entry/node_table_catalog_entry.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/node_table_catalog_entry.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/node_table_catalog_entry.cpp.o.d"
+  "/root/repo/src/catalog/catalog_entry/rdf_graph_catalog_entry.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/rdf_graph_catalog_entry.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/rdf_graph_catalog_entry.cpp.o.d"
+  "/root/repo/src/catalog/catalog_entry/rel_group_catalog_entry.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/rel_group_catalog_entry.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/rel_group_catalog_entry.cpp.o.d"
+  "/root/repo/src/catalog/catalog_entry/rel_table_catalog_entry.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/rel_table_catalog_entry.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/rel_table_catalog_entry.cpp.o.d"
+  "/root/repo/src/catalog/catalog_entry/scalar_macro_catalog_entry.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/scalar_macro_catalog_entry.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/scalar_macro_catalog_entry.cpp.o.d"
+  "/root/repo/src/catalog/catalog_entry/sequence_catalog_entry.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/sequence_catalog_entry.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/sequence_catalog_entry.cpp.o.d"
+  "/root/repo/src/catalog/catalog_entry/table_catalog_entry.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/table_catalog_entry.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/table_catalog_entry.cpp.o.d"
+  "/root/repo/src/catalog/catalog_entry/type_catalog_entry.cpp" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/type_catalog_entry.cpp.o" "gcc" "src/catalog/catalog_entry/CMakeFiles/kuzu_catalog_entry.dir/type_catalog_entry.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
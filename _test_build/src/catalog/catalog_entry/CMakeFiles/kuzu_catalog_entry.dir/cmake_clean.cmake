@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_catalog_entry.dir/catalog_entry.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/catalog_entry.cpp.o.d"
+  "CMakeFiles/kuzu_catalog_entry.dir/catalog_entry_type.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/catalog_entry_type.cpp.o.d"
+  "CMakeFiles/kuzu_catalog_entry.dir/function_catalog_entry.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/function_catalog_entry.cpp.o.d"
+  "CMakeFiles/kuzu_catalog_entry.dir/node_table_catalog_entry.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/node_table_catalog_entry.cpp.o.d"
+  "CMakeFiles/kuzu_catalog_entry.dir/rdf_graph_catalog_entry.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/rdf_graph_catalog_entry.cpp.o.d"
+  "CMakeFiles/kuzu_catalog_entry.dir/rel_group_catalog_entry.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/rel_group_catalog_entry.cpp.o.d"
+  "CMakeFiles/kuzu_catalog_entry.dir/rel_table_catalog_entry.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/rel_table_catalog_entry.cpp.o.d"
+  "CMakeFiles/kuzu_catalog_entry.dir/scalar_macro_catalog_entry.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/scalar_macro_catalog_entry.cpp.o.d"
+  "CMakeFiles/kuzu_catalog_entry.dir/sequence_catalog_entry.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/sequence_catalog_entry.cpp.o.d"
+  "CMakeFiles/kuzu_catalog_entry.dir/table_catalog_entry.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/table_catalog_entry.cpp.o.d"
+  "CMakeFiles/kuzu_catalog_entry.dir/type_catalog_entry.cpp.o"
+  "CMakeFiles/kuzu_catalog_entry.dir/type_catalog_entry.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_catalog_entry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/case_insensitive_map.cpp" "src/common/CMakeFiles/kuzu_common.dir/case_insensitive_map.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/case_insensitive_map.cpp.o.d"
+  "/root/repo/src/common/constants.cpp" "src/common/CMakeFiles/kuzu_common.dir/constants.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/constants.cpp.o.d"
+  "/root/repo/src/common/expression_type.cpp" "src/common/CMakeFiles/kuzu_common.dir/expression_type.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/expression_type.cpp.o.d"
+  "/root/repo/src/common/hyperloglog.cpp" "src/common/CMakeFiles/kuzu_common.dir/hyperloglog.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/hyperloglog.cpp.o.d"
+  "/root/repo/src/common/in_mem_overflow_buffer.cpp" "src/common/CMakeFiles/kuzu_common.dir/in_mem_overflow_buffer.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/in_mem_overflow_buffer.cpp.o.d"
+  "/root/repo/src/common/md5.cpp" "src/common/CMakeFiles/kuzu_common.dir/md5.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/md5.cpp.o.d"
+  "/root/repo/src/common/metric.cpp" "src/common/CMakeFiles/kuzu_common.dir/metric.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/metric.cpp.o.d"
+  "/root/repo/src/common/null_mask.cpp" "src/common/CMakeFiles/kuzu_common.dir/null_mask.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/null_mask.cpp.o.d"
+  "/root/repo/src/common/profiler.cpp" "src/common/CMakeFiles/kuzu_common.dir/profiler.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/profiler.cpp.o.d"
+  "/root/repo/src/common/random_engine.cpp" "src/common/CMakeFiles/kuzu_common.dir/random_engine.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/random_engine.cpp.o.d"
+  "/root/repo/src/common/sha256.cpp" "src/common/CMakeFiles/kuzu_common.dir/sha256.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/sha256.cpp.o.d"
+  "/root/repo/src/common/string_utils.cpp" "src/common/CMakeFiles/kuzu_common.dir/string_utils.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/string_utils.cpp.o.d"
+  "/root/repo/src/common/system_message.cpp" "src/common/CMakeFiles/kuzu_common.dir/system_message.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/system_message.cpp.o.d"
+  "/root/repo/src/common/type_utils.cpp" "src/common/CMakeFiles/kuzu_common.dir/type_utils.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/type_utils.cpp.o.d"
+  "/root/repo/src/common/utils.cpp" "src/common/CMakeFiles/kuzu_common.dir/utils.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/utils.cpp.o.d"
+  "/root/repo/src/common/windows_utils.cpp" "src/common/CMakeFiles/kuzu_common.dir/windows_utils.cpp.o" "gcc" "src/common/CMakeFiles/kuzu_common.dir/windows_utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common.dir/case_insensitive_map.cpp.o"
+  "CMakeFiles/kuzu_common.dir/case_insensitive_map.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/constants.cpp.o"
+  "CMakeFiles/kuzu_common.dir/constants.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/expression_type.cpp.o"
+  "CMakeFiles/kuzu_common.dir/expression_type.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/hyperloglog.cpp.o"
+  "CMakeFiles/kuzu_common.dir/hyperloglog.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/in_mem_overflow_buffer.cpp.o"
+  "CMakeFiles/kuzu_common.dir/in_mem_overflow_buffer.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/md5.cpp.o"
+  "CMakeFiles/kuzu_common.dir/md5.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/metric.cpp.o"
+  "CMakeFiles/kuzu_common.dir/metric.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/null_mask.cpp.o"
+  "CMakeFiles/kuzu_common.dir/null_mask.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/profiler.cpp.o"
+  "CMakeFiles/kuzu_common.dir/profiler.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/random_engine.cpp.o"
+  "CMakeFiles/kuzu_common.dir/random_engine.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/sha256.cpp.o"
+  "CMakeFiles/kuzu_common.dir/sha256.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/string_utils.cpp.o"
+  "CMakeFiles/kuzu_common.dir/string_utils.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/system_message.cpp.o"
+  "CMakeFiles/kuzu_common.dir/system_message.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/type_utils.cpp.o"
+  "CMakeFiles/kuzu_common.dir/type_utils.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/utils.cpp.o"
+  "CMakeFiles/kuzu_common.dir/utils.cpp.o.d"
+  "CMakeFiles/kuzu_common.dir/windows_utils.cpp.o"
+  "CMakeFiles/kuzu_common.dir/windows_utils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/arrow/arrow_array_scan.cpp" "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/arrow_array_scan.cpp.o" "gcc" "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/arrow_array_scan.cpp.o.d"
+  "/root/repo/src/common/arrow/arrow_converter.cpp" "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/arrow_converter.cpp.o" "gcc" "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/arrow_converter.cpp.o.d"
+  "/root/repo/src/common/arrow/arrow_null_mask_tree.cpp" "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/arrow_null_mask_tree.cpp.o" "gcc" "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/arrow_null_mask_tree.cpp.o.d"
+  "/root/repo/src/common/arrow/arrow_row_batch.cpp" "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/arrow_row_batch.cpp.o" "gcc" "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/arrow_row_batch.cpp.o.d"
+  "/root/repo/src/common/arrow/arrow_type.cpp" "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/arrow_type.cpp.o" "gcc" "src/common/arrow/CMakeFiles/kuzu_common_arrow.dir/arrow_type.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common_arrow.dir/arrow_array_scan.cpp.o"
+  "CMakeFiles/kuzu_common_arrow.dir/arrow_array_scan.cpp.o.d"
+  "CMakeFiles/kuzu_common_arrow.dir/arrow_converter.cpp.o"
+  "CMakeFiles/kuzu_common_arrow.dir/arrow_converter.cpp.o.d"
+  "CMakeFiles/kuzu_common_arrow.dir/arrow_null_mask_tree.cpp.o"
+  "CMakeFiles/kuzu_common_arrow.dir/arrow_null_mask_tree.cpp.o.d"
+  "CMakeFiles/kuzu_common_arrow.dir/arrow_row_batch.cpp.o"
+  "CMakeFiles/kuzu_common_arrow.dir/arrow_row_batch.cpp.o.d"
+  "CMakeFiles/kuzu_common_arrow.dir/arrow_type.cpp.o"
+  "CMakeFiles/kuzu_common_arrow.dir/arrow_type.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common_arrow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
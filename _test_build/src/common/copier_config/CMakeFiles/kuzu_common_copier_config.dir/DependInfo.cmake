@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/copier_config/csv_reader_config.cpp" "src/common/copier_config/CMakeFiles/kuzu_common_copier_config.dir/csv_reader_config.cpp.o" "gcc" "src/common/copier_config/CMakeFiles/kuzu_common_copier_config.dir/csv_reader_config.cpp.o.d"
+  "/root/repo/src/common/copier_config/rdf_reader_config.cpp" "src/common/copier_config/CMakeFiles/kuzu_common_copier_config.dir/rdf_reader_config.cpp.o" "gcc" "src/common/copier_config/CMakeFiles/kuzu_common_copier_config.dir/rdf_reader_config.cpp.o.d"
+  "/root/repo/src/common/copier_config/reader_config.cpp" "src/common/copier_config/CMakeFiles/kuzu_common_copier_config.dir/reader_config.cpp.o" "gcc" "src/common/copier_config/CMakeFiles/kuzu_common_copier_config.dir/reader_config.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common_copier_config.dir/csv_reader_config.cpp.o"
+  "CMakeFiles/kuzu_common_copier_config.dir/csv_reader_config.cpp.o.d"
+  "CMakeFiles/kuzu_common_copier_config.dir/rdf_reader_config.cpp.o"
+  "CMakeFiles/kuzu_common_copier_config.dir/rdf_reader_config.cpp.o.d"
+  "CMakeFiles/kuzu_common_copier_config.dir/reader_config.cpp.o"
+  "CMakeFiles/kuzu_common_copier_config.dir/reader_config.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common_copier_config.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/data_chunk/data_chunk.cpp" "src/common/data_chunk/CMakeFiles/kuzu_common_data_chunk.dir/data_chunk.cpp.o" "gcc" "src/common/data_chunk/CMakeFiles/kuzu_common_data_chunk.dir/data_chunk.cpp.o.d"
+  "/root/repo/src/common/data_chunk/data_chunk_collection.cpp" "src/common/data_chunk/CMakeFiles/kuzu_common_data_chunk.dir/data_chunk_collection.cpp.o" "gcc" "src/common/data_chunk/CMakeFiles/kuzu_common_data_chunk.dir/data_chunk_collection.cpp.o.d"
+  "/root/repo/src/common/data_chunk/data_chunk_state.cpp" "src/common/data_chunk/CMakeFiles/kuzu_common_data_chunk.dir/data_chunk_state.cpp.o" "gcc" "src/common/data_chunk/CMakeFiles/kuzu_common_data_chunk.dir/data_chunk_state.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common_data_chunk.dir/data_chunk.cpp.o"
+  "CMakeFiles/kuzu_common_data_chunk.dir/data_chunk.cpp.o.d"
+  "CMakeFiles/kuzu_common_data_chunk.dir/data_chunk_collection.cpp.o"
+  "CMakeFiles/kuzu_common_data_chunk.dir/data_chunk_collection.cpp.o.d"
+  "CMakeFiles/kuzu_common_data_chunk.dir/data_chunk_state.cpp.o"
+  "CMakeFiles/kuzu_common_data_chunk.dir/data_chunk_state.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common_data_chunk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
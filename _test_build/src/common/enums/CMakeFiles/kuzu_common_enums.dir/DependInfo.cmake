@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/enums/accumulate_type.cpp" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/accumulate_type.cpp.o" "gcc" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/accumulate_type.cpp.o.d"
+  "/root/repo/src/common/enums/conflict_action.cpp" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/conflict_action.cpp.o" "gcc" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/conflict_action.cpp.o.d"
+  "/root/repo/src/common/enums/drop_type.cpp" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/drop_type.cpp.o" "gcc" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/drop_type.cpp.o.d"
+  "/root/repo/src/common/enums/path_semantic.cpp" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/path_semantic.cpp.o" "gcc" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/path_semantic.cpp.o.d"
+  "/root/repo/src/common/enums/rel_direction.cpp" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/rel_direction.cpp.o" "gcc" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/rel_direction.cpp.o.d"
+  "/root/repo/src/common/enums/rel_multiplicity.cpp" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/rel_multiplicity.cpp.o" "gcc" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/rel_multiplicity.cpp.o.d"
+  "/root/repo/src/common/enums/scan_source_type.cpp" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/scan_source_type.cpp.o" "gcc" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/scan_source_type.cpp.o.d"
+  "/root/repo/src/common/enums/table_type.cpp" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/table_type.cpp.o" "gcc" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/table_type.cpp.o.d"
+  "/root/repo/src/common/enums/transaction_action.cpp" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/transaction_action.cpp.o" "gcc" "src/common/enums/CMakeFiles/kuzu_common_enums.dir/transaction_action.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common_enums.dir/accumulate_type.cpp.o"
+  "CMakeFiles/kuzu_common_enums.dir/accumulate_type.cpp.o.d"
+  "CMakeFiles/kuzu_common_enums.dir/conflict_action.cpp.o"
+  "CMakeFiles/kuzu_common_enums.dir/conflict_action.cpp.o.d"
+  "CMakeFiles/kuzu_common_enums.dir/drop_type.cpp.o"
+  "CMakeFiles/kuzu_common_enums.dir/drop_type.cpp.o.d"
+  "CMakeFiles/kuzu_common_enums.dir/path_semantic.cpp.o"
+  "CMakeFiles/kuzu_common_enums.dir/path_semantic.cpp.o.d"
+  "CMakeFiles/kuzu_common_enums.dir/rel_direction.cpp.o"
+  "CMakeFiles/kuzu_common_enums.dir/rel_direction.cpp.o.d"
+  "CMakeFiles/kuzu_common_enums.dir/rel_multiplicity.cpp.o"
+  "CMakeFiles/kuzu_common_enums.dir/rel_multiplicity.cpp.o.d"
+  "CMakeFiles/kuzu_common_enums.dir/scan_source_type.cpp.o"
+  "CMakeFiles/kuzu_common_enums.dir/scan_source_type.cpp.o.d"
+  "CMakeFiles/kuzu_common_enums.dir/table_type.cpp.o"
+  "CMakeFiles/kuzu_common_enums.dir/table_type.cpp.o.d"
+  "CMakeFiles/kuzu_common_enums.dir/transaction_action.cpp.o"
+  "CMakeFiles/kuzu_common_enums.dir/transaction_action.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common_enums.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
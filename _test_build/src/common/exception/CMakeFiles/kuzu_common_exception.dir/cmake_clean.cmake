@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common_exception.dir/exception.cpp.o"
+  "CMakeFiles/kuzu_common_exception.dir/exception.cpp.o.d"
+  "CMakeFiles/kuzu_common_exception.dir/message.cpp.o"
+  "CMakeFiles/kuzu_common_exception.dir/message.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common_exception.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/file_system/file_info.cpp" "src/common/file_system/CMakeFiles/kuzu_file_system.dir/file_info.cpp.o" "gcc" "src/common/file_system/CMakeFiles/kuzu_file_system.dir/file_info.cpp.o.d"
+  "/root/repo/src/common/file_system/file_system.cpp" "src/common/file_system/CMakeFiles/kuzu_file_system.dir/file_system.cpp.o" "gcc" "src/common/file_system/CMakeFiles/kuzu_file_system.dir/file_system.cpp.o.d"
+  "/root/repo/src/common/file_system/local_file_system.cpp" "src/common/file_system/CMakeFiles/kuzu_file_system.dir/local_file_system.cpp.o" "gcc" "src/common/file_system/CMakeFiles/kuzu_file_system.dir/local_file_system.cpp.o.d"
+  "/root/repo/src/common/file_system/virtual_file_system.cpp" "src/common/file_system/CMakeFiles/kuzu_file_system.dir/virtual_file_system.cpp.o" "gcc" "src/common/file_system/CMakeFiles/kuzu_file_system.dir/virtual_file_system.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_file_system.dir/file_info.cpp.o"
+  "CMakeFiles/kuzu_file_system.dir/file_info.cpp.o.d"
+  "CMakeFiles/kuzu_file_system.dir/file_system.cpp.o"
+  "CMakeFiles/kuzu_file_system.dir/file_system.cpp.o.d"
+  "CMakeFiles/kuzu_file_system.dir/local_file_system.cpp.o"
+  "CMakeFiles/kuzu_file_system.dir/local_file_system.cpp.o.d"
+  "CMakeFiles/kuzu_file_system.dir/virtual_file_system.cpp.o"
+  "CMakeFiles/kuzu_file_system.dir/virtual_file_system.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_file_system.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/serializer/buffered_file.cpp" "src/common/serializer/CMakeFiles/kuzu_common_serializer.dir/buffered_file.cpp.o" "gcc" "src/common/serializer/CMakeFiles/kuzu_common_serializer.dir/buffered_file.cpp.o.d"
+  "/root/repo/src/common/serializer/buffered_serializer.cpp" "src/common/serializer/CMakeFiles/kuzu_common_serializer.dir/buffered_serializer.cpp.o" "gcc" "src/common/serializer/CMakeFiles/kuzu_common_serializer.dir/buffered_serializer.cpp.o.d"
+  "/root/repo/src/common/serializer/deserializer.cpp" "src/common/serializer/CMakeFiles/kuzu_common_serializer.dir/deserializer.cpp.o" "gcc" "src/common/serializer/CMakeFiles/kuzu_common_serializer.dir/deserializer.cpp.o.d"
+  "/root/repo/src/common/serializer/serializer.cpp" "src/common/serializer/CMakeFiles/kuzu_common_serializer.dir/serializer.cpp.o" "gcc" "src/common/serializer/CMakeFiles/kuzu_common_serializer.dir/serializer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
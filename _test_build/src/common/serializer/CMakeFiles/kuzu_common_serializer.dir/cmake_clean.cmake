@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common_serializer.dir/buffered_file.cpp.o"
+  "CMakeFiles/kuzu_common_serializer.dir/buffered_file.cpp.o.d"
+  "CMakeFiles/kuzu_common_serializer.dir/buffered_serializer.cpp.o"
+  "CMakeFiles/kuzu_common_serializer.dir/buffered_serializer.cpp.o.d"
+  "CMakeFiles/kuzu_common_serializer.dir/deserializer.cpp.o"
+  "CMakeFiles/kuzu_common_serializer.dir/deserializer.cpp.o.d"
+  "CMakeFiles/kuzu_common_serializer.dir/serializer.cpp.o"
+  "CMakeFiles/kuzu_common_serializer.dir/serializer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common_serializer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/task_system/progress_bar.cpp" "src/common/task_system/CMakeFiles/kuzu_common_task_system.dir/progress_bar.cpp.o" "gcc" "src/common/task_system/CMakeFiles/kuzu_common_task_system.dir/progress_bar.cpp.o.d"
+  "/root/repo/src/common/task_system/task.cpp" "src/common/task_system/CMakeFiles/kuzu_common_task_system.dir/task.cpp.o" "gcc" "src/common/task_system/CMakeFiles/kuzu_common_task_system.dir/task.cpp.o.d"
+  "/root/repo/src/common/task_system/task_scheduler.cpp" "src/common/task_system/CMakeFiles/kuzu_common_task_system.dir/task_scheduler.cpp.o" "gcc" "src/common/task_system/CMakeFiles/kuzu_common_task_system.dir/task_scheduler.cpp.o.d"
+  "/root/repo/src/common/task_system/terminal_progress_bar_display.cpp" "src/common/task_system/CMakeFiles/kuzu_common_task_system.dir/terminal_progress_bar_display.cpp.o" "gcc" "src/common/task_system/CMakeFiles/kuzu_common_task_system.dir/terminal_progress_bar_display.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common_task_system.dir/progress_bar.cpp.o"
+  "CMakeFiles/kuzu_common_task_system.dir/progress_bar.cpp.o.d"
+  "CMakeFiles/kuzu_common_task_system.dir/task.cpp.o"
+  "CMakeFiles/kuzu_common_task_system.dir/task.cpp.o.d"
+  "CMakeFiles/kuzu_common_task_system.dir/task_scheduler.cpp.o"
+  "CMakeFiles/kuzu_common_task_system.dir/task_scheduler.cpp.o.d"
+  "CMakeFiles/kuzu_common_task_system.dir/terminal_progress_bar_display.cpp.o"
+  "CMakeFiles/kuzu_common_task_system.dir/terminal_progress_bar_display.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common_task_system.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
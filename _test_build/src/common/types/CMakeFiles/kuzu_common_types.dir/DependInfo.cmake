@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/types/blob.cpp" "src/common/types/CMakeFiles/kuzu_common_types.dir/blob.cpp.o" "gcc" "src/common/types/CMakeFiles/kuzu_common_types.dir/blob.cpp.o.d"
+  "/root/repo/src/common/types/date_t.cpp" "src/common/types/CMakeFiles/kuzu_common_types.dir/date_t.cpp.o" "gcc" "src/common/types/CMakeFiles/kuzu_common_types.dir/date_t.cpp.o.d"
+  "/root/repo/src/common/types/dtime_t.cpp" "src/common/types/CMakeFiles/kuzu_common_types.dir/dtime_t.cpp.o" "gcc" "src/common/types/CMakeFiles/kuzu_common_types.dir/dtime_t.cpp.o.d"
+  "/root/repo/src/common/types/int128_t.cpp" "src/common/types/CMakeFiles/kuzu_common_types.dir/int128_t.cpp.o" "gcc" "src/common/types/CMakeFiles/kuzu_common_types.dir/int128_t.cpp.o.d"
+  "/root/repo/src/common/types/interval_t.cpp" "src/common/types/CMakeFiles/kuzu_common_types.dir/interval_t.cpp.o" "gcc" "src/common/types/CMakeFiles/kuzu_common_types.dir/interval_t.cpp.o.d"
+  "/root/repo/src/common/types/ku_list.cpp" "src/common/types/CMakeFiles/kuzu_common_types.dir/ku_list.cpp.o" "gcc" "src/common/types/CMakeFiles/kuzu_common_types.dir/ku_list.cpp.o.d"
+  "/root/repo/src/common/types/ku_string.cpp" "src/common/types/CMakeFiles/kuzu_common_types.dir/ku_string.cpp.o" "gcc" "src/common/types/CMakeFiles/kuzu_common_types.dir/ku_string.cpp.o.d"
+  "/root/repo/src/common/types/timestamp_t.cpp" "src/common/types/CMakeFiles/kuzu_common_types.dir/timestamp_t.cpp.o" "gcc" "src/common/types/CMakeFiles/kuzu_common_types.dir/timestamp_t.cpp.o.d"
+  "/root/repo/src/common/types/types.cpp" "src/common/types/CMakeFiles/kuzu_common_types.dir/types.cpp.o" "gcc" "src/common/types/CMakeFiles/kuzu_common_types.dir/types.cpp.o.d"
+  "/root/repo/src/common/types/uuid.cpp" "src/common/types/CMakeFiles/kuzu_common_types.dir/uuid.cpp.o" "gcc" "src/common/types/CMakeFiles/kuzu_common_types.dir/uuid.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
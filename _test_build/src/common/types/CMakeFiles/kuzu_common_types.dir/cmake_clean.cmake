@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common_types.dir/blob.cpp.o"
+  "CMakeFiles/kuzu_common_types.dir/blob.cpp.o.d"
+  "CMakeFiles/kuzu_common_types.dir/date_t.cpp.o"
+  "CMakeFiles/kuzu_common_types.dir/date_t.cpp.o.d"
+  "CMakeFiles/kuzu_common_types.dir/dtime_t.cpp.o"
+  "CMakeFiles/kuzu_common_types.dir/dtime_t.cpp.o.d"
+  "CMakeFiles/kuzu_common_types.dir/int128_t.cpp.o"
+  "CMakeFiles/kuzu_common_types.dir/int128_t.cpp.o.d"
+  "CMakeFiles/kuzu_common_types.dir/interval_t.cpp.o"
+  "CMakeFiles/kuzu_common_types.dir/interval_t.cpp.o.d"
+  "CMakeFiles/kuzu_common_types.dir/ku_list.cpp.o"
+  "CMakeFiles/kuzu_common_types.dir/ku_list.cpp.o.d"
+  "CMakeFiles/kuzu_common_types.dir/ku_string.cpp.o"
+  "CMakeFiles/kuzu_common_types.dir/ku_string.cpp.o.d"
+  "CMakeFiles/kuzu_common_types.dir/timestamp_t.cpp.o"
+  "CMakeFiles/kuzu_common_types.dir/timestamp_t.cpp.o.d"
+  "CMakeFiles/kuzu_common_types.dir/types.cpp.o"
+  "CMakeFiles/kuzu_common_types.dir/types.cpp.o.d"
+  "CMakeFiles/kuzu_common_types.dir/uuid.cpp.o"
+  "CMakeFiles/kuzu_common_types.dir/uuid.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common_types.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
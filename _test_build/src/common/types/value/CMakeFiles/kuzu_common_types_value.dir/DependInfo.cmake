@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/types/value/nested.cpp" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/nested.cpp.o" "gcc" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/nested.cpp.o.d"
+  "/root/repo/src/common/types/value/node.cpp" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/node.cpp.o" "gcc" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/node.cpp.o.d"
+  "/root/repo/src/common/types/value/rdf_variant.cpp" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/rdf_variant.cpp.o" "gcc" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/rdf_variant.cpp.o.d"
+  "/root/repo/src/common/types/value/recursive_rel.cpp" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/recursive_rel.cpp.o" "gcc" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/recursive_rel.cpp.o.d"
+  "/root/repo/src/common/types/value/rel.cpp" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/rel.cpp.o" "gcc" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/rel.cpp.o.d"
+  "/root/repo/src/common/types/value/value.cpp" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/value.cpp.o" "gcc" "src/common/types/value/CMakeFiles/kuzu_common_types_value.dir/value.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common_types_value.dir/nested.cpp.o"
+  "CMakeFiles/kuzu_common_types_value.dir/nested.cpp.o.d"
+  "CMakeFiles/kuzu_common_types_value.dir/node.cpp.o"
+  "CMakeFiles/kuzu_common_types_value.dir/node.cpp.o.d"
+  "CMakeFiles/kuzu_common_types_value.dir/rdf_variant.cpp.o"
+  "CMakeFiles/kuzu_common_types_value.dir/rdf_variant.cpp.o.d"
+  "CMakeFiles/kuzu_common_types_value.dir/recursive_rel.cpp.o"
+  "CMakeFiles/kuzu_common_types_value.dir/recursive_rel.cpp.o.d"
+  "CMakeFiles/kuzu_common_types_value.dir/rel.cpp.o"
+  "CMakeFiles/kuzu_common_types_value.dir/rel.cpp.o.d"
+  "CMakeFiles/kuzu_common_types_value.dir/value.cpp.o"
+  "CMakeFiles/kuzu_common_types_value.dir/value.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common_types_value.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
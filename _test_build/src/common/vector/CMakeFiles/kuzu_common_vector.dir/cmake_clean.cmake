@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_common_vector.dir/auxiliary_buffer.cpp.o"
+  "CMakeFiles/kuzu_common_vector.dir/auxiliary_buffer.cpp.o.d"
+  "CMakeFiles/kuzu_common_vector.dir/value_vector.cpp.o"
+  "CMakeFiles/kuzu_common_vector.dir/value_vector.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_common_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
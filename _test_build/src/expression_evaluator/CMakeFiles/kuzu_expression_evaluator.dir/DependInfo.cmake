@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/expression_evaluator/case_evaluator.cpp" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/case_evaluator.cpp.o" "gcc" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/case_evaluator.cpp.o.d"
+  "/root/repo/src/expression_evaluator/expression_evaluator.cpp" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator.cpp.o" "gcc" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator.cpp.o.d"
+  "/root/repo/src/expression_evaluator/expression_evaluator_utils.cpp" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator_utils.cpp.o" "gcc" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator_utils.cpp.o.d"
+  "/root/repo/src/expression_evaluator/expression_evaluator_visitor.cpp" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator_visitor.cpp.o" "gcc" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator_visitor.cpp.o.d"
+  "/root/repo/src/expression_evaluator/function_evaluator.cpp" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/function_evaluator.cpp.o" "gcc" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/function_evaluator.cpp.o.d"
+  "/root/repo/src/expression_evaluator/lambda_evaluator.cpp" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/lambda_evaluator.cpp.o" "gcc" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/lambda_evaluator.cpp.o.d"
+  "/root/repo/src/expression_evaluator/literal_evaluator.cpp" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/literal_evaluator.cpp.o" "gcc" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/literal_evaluator.cpp.o.d"
+  "/root/repo/src/expression_evaluator/path_evaluator.cpp" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/path_evaluator.cpp.o" "gcc" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/path_evaluator.cpp.o.d"
+  "/root/repo/src/expression_evaluator/pattern_evaluator.cpp" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/pattern_evaluator.cpp.o" "gcc" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/pattern_evaluator.cpp.o.d"
+  "/root/repo/src/expression_evaluator/reference_evaluator.cpp" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/reference_evaluator.cpp.o" "gcc" "src/expression_evaluator/CMakeFiles/kuzu_expression_evaluator.dir/reference_evaluator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
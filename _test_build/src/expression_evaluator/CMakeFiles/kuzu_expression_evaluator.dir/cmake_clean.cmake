@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_expression_evaluator.dir/case_evaluator.cpp.o"
+  "CMakeFiles/kuzu_expression_evaluator.dir/case_evaluator.cpp.o.d"
+  "CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator.cpp.o"
+  "CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator.cpp.o.d"
+  "CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator_utils.cpp.o"
+  "CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator_utils.cpp.o.d"
+  "CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator_visitor.cpp.o"
+  "CMakeFiles/kuzu_expression_evaluator.dir/expression_evaluator_visitor.cpp.o.d"
+  "CMakeFiles/kuzu_expression_evaluator.dir/function_evaluator.cpp.o"
+  "CMakeFiles/kuzu_expression_evaluator.dir/function_evaluator.cpp.o.d"
+  "CMakeFiles/kuzu_expression_evaluator.dir/lambda_evaluator.cpp.o"
+  "CMakeFiles/kuzu_expression_evaluator.dir/lambda_evaluator.cpp.o.d"
+  "CMakeFiles/kuzu_expression_evaluator.dir/literal_evaluator.cpp.o"
+  "CMakeFiles/kuzu_expression_evaluator.dir/literal_evaluator.cpp.o.d"
+  "CMakeFiles/kuzu_expression_evaluator.dir/path_evaluator.cpp.o"
+  "CMakeFiles/kuzu_expression_evaluator.dir/path_evaluator.cpp.o.d"
+  "CMakeFiles/kuzu_expression_evaluator.dir/pattern_evaluator.cpp.o"
+  "CMakeFiles/kuzu_expression_evaluator.dir/pattern_evaluator.cpp.o.d"
+  "CMakeFiles/kuzu_expression_evaluator.dir/reference_evaluator.cpp.o"
+  "CMakeFiles/kuzu_expression_evaluator.dir/reference_evaluator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_expression_evaluator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/extension/catalog_extension.cpp" "src/extension/CMakeFiles/kuzu_extension.dir/catalog_extension.cpp.o" "gcc" "src/extension/CMakeFiles/kuzu_extension.dir/catalog_extension.cpp.o.d"
+  "/root/repo/src/extension/extension.cpp" "src/extension/CMakeFiles/kuzu_extension.dir/extension.cpp.o" "gcc" "src/extension/CMakeFiles/kuzu_extension.dir/extension.cpp.o.d"
+  "/root/repo/src/extension/extension_installer.cpp" "src/extension/CMakeFiles/kuzu_extension.dir/extension_installer.cpp.o" "gcc" "src/extension/CMakeFiles/kuzu_extension.dir/extension_installer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_extension.dir/catalog_extension.cpp.o"
+  "CMakeFiles/kuzu_extension.dir/catalog_extension.cpp.o.d"
+  "CMakeFiles/kuzu_extension.dir/extension.cpp.o"
+  "CMakeFiles/kuzu_extension.dir/extension.cpp.o.d"
+  "CMakeFiles/kuzu_extension.dir/extension_installer.cpp.o"
+  "CMakeFiles/kuzu_extension.dir/extension_installer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_extension.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/aggregate_function.cpp" "src/function/CMakeFiles/kuzu_function.dir/aggregate_function.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/aggregate_function.cpp.o.d"
+  "/root/repo/src/function/base_lower_upper_operation.cpp" "src/function/CMakeFiles/kuzu_function.dir/base_lower_upper_operation.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/base_lower_upper_operation.cpp.o.d"
+  "/root/repo/src/function/built_in_function_utils.cpp" "src/function/CMakeFiles/kuzu_function.dir/built_in_function_utils.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/built_in_function_utils.cpp.o.d"
+  "/root/repo/src/function/cast_from_string_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/cast_from_string_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/cast_from_string_functions.cpp.o.d"
+  "/root/repo/src/function/cast_string_non_nested_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/cast_string_non_nested_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/cast_string_non_nested_functions.cpp.o.d"
+  "/root/repo/src/function/comparison_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/comparison_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/comparison_functions.cpp.o.d"
+  "/root/repo/src/function/find_function.cpp" "src/function/CMakeFiles/kuzu_function.dir/find_function.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/find_function.cpp.o.d"
+  "/root/repo/src/function/function.cpp" "src/function/CMakeFiles/kuzu_function.dir/function.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/function.cpp.o.d"
+  "/root/repo/src/function/function_collection.cpp" "src/function/CMakeFiles/kuzu_function.dir/function_collection.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/function_collection.cpp.o.d"
+  "/root/repo/src/function/scalar_macro_function.cpp" "src/function/CMakeFiles/kuzu_function.dir/scalar_macro_function.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/scalar_macro_function.cpp.o.d"
+  "/root/repo/src/function/vector_arithmetic_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_arithmetic_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_arithmetic_functions.cpp.o.d"
+  "/root/repo/src/function/vector_blob_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_blob_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_blob_functions.cpp.o.d"
+  "/root/repo/src/function/vector_boolean_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_boolean_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_boolean_functions.cpp.o.d"
+  "/root/repo/src/function/vector_cast_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_cast_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_cast_functions.cpp.o.d"
+  "/root/repo/src/function/vector_date_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_date_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_date_functions.cpp.o.d"
+  "/root/repo/src/function/vector_hash_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_hash_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_hash_functions.cpp.o.d"
+  "/root/repo/src/function/vector_node_rel_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_node_rel_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_node_rel_functions.cpp.o.d"
+  "/root/repo/src/function/vector_null_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_null_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_null_functions.cpp.o.d"
+  "/root/repo/src/function/vector_rdf_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_rdf_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_rdf_functions.cpp.o.d"
+  "/root/repo/src/function/vector_string_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_string_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_string_functions.cpp.o.d"
+  "/root/repo/src/function/vector_timestamp_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_timestamp_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_timestamp_functions.cpp.o.d"
+  "/root/repo/src/function/vector_uuid_functions.cpp" "src/function/CMakeFiles/kuzu_function.dir/vector_uuid_functions.cpp.o" "gcc" "src/function/CMakeFiles/kuzu_function.dir/vector_uuid_functions.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function.dir/aggregate_function.cpp.o"
+  "CMakeFiles/kuzu_function.dir/aggregate_function.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/base_lower_upper_operation.cpp.o"
+  "CMakeFiles/kuzu_function.dir/base_lower_upper_operation.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/built_in_function_utils.cpp.o"
+  "CMakeFiles/kuzu_function.dir/built_in_function_utils.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/cast_from_string_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/cast_from_string_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/cast_string_non_nested_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/cast_string_non_nested_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/comparison_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/comparison_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/find_function.cpp.o"
+  "CMakeFiles/kuzu_function.dir/find_function.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/function.cpp.o"
+  "CMakeFiles/kuzu_function.dir/function.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/function_collection.cpp.o"
+  "CMakeFiles/kuzu_function.dir/function_collection.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/scalar_macro_function.cpp.o"
+  "CMakeFiles/kuzu_function.dir/scalar_macro_function.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_arithmetic_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_arithmetic_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_blob_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_blob_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_boolean_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_boolean_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_cast_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_cast_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_date_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_date_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_hash_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_hash_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_node_rel_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_node_rel_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_null_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_null_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_rdf_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_rdf_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_string_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_string_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_timestamp_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_timestamp_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function.dir/vector_uuid_functions.cpp.o"
+  "CMakeFiles/kuzu_function.dir/vector_uuid_functions.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
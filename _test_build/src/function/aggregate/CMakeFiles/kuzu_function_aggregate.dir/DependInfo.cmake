@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/aggregate/collect.cpp" "src/function/aggregate/CMakeFiles/kuzu_function_aggregate.dir/collect.cpp.o" "gcc" "src/function/aggregate/CMakeFiles/kuzu_function_aggregate.dir/collect.cpp.o.d"
+  "/root/repo/src/function/aggregate/count.cpp" "src/function/aggregate/CMakeFiles/kuzu_function_aggregate.dir/count.cpp.o" "gcc" "src/function/aggregate/CMakeFiles/kuzu_function_aggregate.dir/count.cpp.o.d"
+  "/root/repo/src/function/aggregate/count_star.cpp" "src/function/aggregate/CMakeFiles/kuzu_function_aggregate.dir/count_star.cpp.o" "gcc" "src/function/aggregate/CMakeFiles/kuzu_function_aggregate.dir/count_star.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_aggregate.dir/collect.cpp.o"
+  "CMakeFiles/kuzu_function_aggregate.dir/collect.cpp.o.d"
+  "CMakeFiles/kuzu_function_aggregate.dir/count.cpp.o"
+  "CMakeFiles/kuzu_function_aggregate.dir/count.cpp.o.d"
+  "CMakeFiles/kuzu_function_aggregate.dir/count_star.cpp.o"
+  "CMakeFiles/kuzu_function_aggregate.dir/count_star.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_aggregate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/arithmetic/abs.cpp" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/abs.cpp.o" "gcc" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/abs.cpp.o.d"
+  "/root/repo/src/function/arithmetic/add.cpp" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/add.cpp.o" "gcc" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/add.cpp.o.d"
+  "/root/repo/src/function/arithmetic/divide.cpp" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/divide.cpp.o" "gcc" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/divide.cpp.o.d"
+  "/root/repo/src/function/arithmetic/modulo.cpp" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/modulo.cpp.o" "gcc" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/modulo.cpp.o.d"
+  "/root/repo/src/function/arithmetic/multiply.cpp" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/multiply.cpp.o" "gcc" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/multiply.cpp.o.d"
+  "/root/repo/src/function/arithmetic/negate.cpp" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/negate.cpp.o" "gcc" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/negate.cpp.o.d"
+  "/root/repo/src/function/arithmetic/subtract.cpp" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/subtract.cpp.o" "gcc" "src/function/arithmetic/CMakeFiles/kuzu_function_arithmetic.dir/subtract.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_arithmetic.dir/abs.cpp.o"
+  "CMakeFiles/kuzu_function_arithmetic.dir/abs.cpp.o.d"
+  "CMakeFiles/kuzu_function_arithmetic.dir/add.cpp.o"
+  "CMakeFiles/kuzu_function_arithmetic.dir/add.cpp.o.d"
+  "CMakeFiles/kuzu_function_arithmetic.dir/divide.cpp.o"
+  "CMakeFiles/kuzu_function_arithmetic.dir/divide.cpp.o.d"
+  "CMakeFiles/kuzu_function_arithmetic.dir/modulo.cpp.o"
+  "CMakeFiles/kuzu_function_arithmetic.dir/modulo.cpp.o.d"
+  "CMakeFiles/kuzu_function_arithmetic.dir/multiply.cpp.o"
+  "CMakeFiles/kuzu_function_arithmetic.dir/multiply.cpp.o.d"
+  "CMakeFiles/kuzu_function_arithmetic.dir/negate.cpp.o"
+  "CMakeFiles/kuzu_function_arithmetic.dir/negate.cpp.o.d"
+  "CMakeFiles/kuzu_function_arithmetic.dir/subtract.cpp.o"
+  "CMakeFiles/kuzu_function_arithmetic.dir/subtract.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_arithmetic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_array.dir/array_functions.cpp.o"
+  "CMakeFiles/kuzu_function_array.dir/array_functions.cpp.o.d"
+  "CMakeFiles/kuzu_function_array.dir/array_value.cpp.o"
+  "CMakeFiles/kuzu_function_array.dir/array_value.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_cast.dir/cast_array.cpp.o"
+  "CMakeFiles/kuzu_function_cast.dir/cast_array.cpp.o.d"
+  "CMakeFiles/kuzu_function_cast.dir/cast_rdf_variant.cpp.o"
+  "CMakeFiles/kuzu_function_cast.dir/cast_rdf_variant.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_cast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/export/export_csv_function.cpp" "src/function/export/CMakeFiles/kuzu_function_export.dir/export_csv_function.cpp.o" "gcc" "src/function/export/CMakeFiles/kuzu_function_export.dir/export_csv_function.cpp.o.d"
+  "/root/repo/src/function/export/export_parquet_function.cpp" "src/function/export/CMakeFiles/kuzu_function_export.dir/export_parquet_function.cpp.o" "gcc" "src/function/export/CMakeFiles/kuzu_function_export.dir/export_parquet_function.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
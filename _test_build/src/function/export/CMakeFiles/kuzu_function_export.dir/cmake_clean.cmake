@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_export.dir/export_csv_function.cpp.o"
+  "CMakeFiles/kuzu_function_export.dir/export_csv_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_export.dir/export_parquet_function.cpp.o"
+  "CMakeFiles/kuzu_function_export.dir/export_parquet_function.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_export.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/gds/all_shortest_paths.cpp" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/all_shortest_paths.cpp.o" "gcc" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/all_shortest_paths.cpp.o.d"
+  "/root/repo/src/function/gds/gds.cpp" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/gds.cpp.o" "gcc" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/gds.cpp.o.d"
+  "/root/repo/src/function/gds/gds_frontier.cpp" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/gds_frontier.cpp.o" "gcc" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/gds_frontier.cpp.o.d"
+  "/root/repo/src/function/gds/gds_task.cpp" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/gds_task.cpp.o" "gcc" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/gds_task.cpp.o.d"
+  "/root/repo/src/function/gds/gds_utils.cpp" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/gds_utils.cpp.o" "gcc" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/gds_utils.cpp.o.d"
+  "/root/repo/src/function/gds/output_writer.cpp" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/output_writer.cpp.o" "gcc" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/output_writer.cpp.o.d"
+  "/root/repo/src/function/gds/page_rank.cpp" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/page_rank.cpp.o" "gcc" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/page_rank.cpp.o.d"
+  "/root/repo/src/function/gds/rec_joins.cpp" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/rec_joins.cpp.o" "gcc" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/rec_joins.cpp.o.d"
+  "/root/repo/src/function/gds/single_shortest_paths.cpp" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/single_shortest_paths.cpp.o" "gcc" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/single_shortest_paths.cpp.o.d"
+  "/root/repo/src/function/gds/weakly_connected_components.cpp" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/weakly_connected_components.cpp.o" "gcc" "src/function/gds/CMakeFiles/kuzu_function_algorithm.dir/weakly_connected_components.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
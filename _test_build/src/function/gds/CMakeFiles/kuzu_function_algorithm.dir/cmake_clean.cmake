@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_algorithm.dir/all_shortest_paths.cpp.o"
+  "CMakeFiles/kuzu_function_algorithm.dir/all_shortest_paths.cpp.o.d"
+  "CMakeFiles/kuzu_function_algorithm.dir/gds.cpp.o"
+  "CMakeFiles/kuzu_function_algorithm.dir/gds.cpp.o.d"
+  "CMakeFiles/kuzu_function_algorithm.dir/gds_frontier.cpp.o"
+  "CMakeFiles/kuzu_function_algorithm.dir/gds_frontier.cpp.o.d"
+  "CMakeFiles/kuzu_function_algorithm.dir/gds_task.cpp.o"
+  "CMakeFiles/kuzu_function_algorithm.dir/gds_task.cpp.o.d"
+  "CMakeFiles/kuzu_function_algorithm.dir/gds_utils.cpp.o"
+  "CMakeFiles/kuzu_function_algorithm.dir/gds_utils.cpp.o.d"
+  "CMakeFiles/kuzu_function_algorithm.dir/output_writer.cpp.o"
+  "CMakeFiles/kuzu_function_algorithm.dir/output_writer.cpp.o.d"
+  "CMakeFiles/kuzu_function_algorithm.dir/page_rank.cpp.o"
+  "CMakeFiles/kuzu_function_algorithm.dir/page_rank.cpp.o.d"
+  "CMakeFiles/kuzu_function_algorithm.dir/rec_joins.cpp.o"
+  "CMakeFiles/kuzu_function_algorithm.dir/rec_joins.cpp.o.d"
+  "CMakeFiles/kuzu_function_algorithm.dir/single_shortest_paths.cpp.o"
+  "CMakeFiles/kuzu_function_algorithm.dir/single_shortest_paths.cpp.o.d"
+  "CMakeFiles/kuzu_function_algorithm.dir/weakly_connected_components.cpp.o"
+  "CMakeFiles/kuzu_function_algorithm.dir/weakly_connected_components.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_algorithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
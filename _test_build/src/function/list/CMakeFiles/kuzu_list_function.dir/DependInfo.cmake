@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/list/list_agg_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_agg_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_agg_function.cpp.o.d"
+  "/root/repo/src/function/list/list_all.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_all.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_all.cpp.o.d"
+  "/root/repo/src/function/list/list_any.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_any.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_any.cpp.o.d"
+  "/root/repo/src/function/list/list_any_value_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_any_value_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_any_value_function.cpp.o.d"
+  "/root/repo/src/function/list/list_append_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_append_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_append_function.cpp.o.d"
+  "/root/repo/src/function/list/list_concat_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_concat_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_concat_function.cpp.o.d"
+  "/root/repo/src/function/list/list_contains_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_contains_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_contains_function.cpp.o.d"
+  "/root/repo/src/function/list/list_creation.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_creation.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_creation.cpp.o.d"
+  "/root/repo/src/function/list/list_distinct_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_distinct_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_distinct_function.cpp.o.d"
+  "/root/repo/src/function/list/list_extract_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_extract_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_extract_function.cpp.o.d"
+  "/root/repo/src/function/list/list_filter.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_filter.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_filter.cpp.o.d"
+  "/root/repo/src/function/list/list_none.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_none.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_none.cpp.o.d"
+  "/root/repo/src/function/list/list_position_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_position_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_position_function.cpp.o.d"
+  "/root/repo/src/function/list/list_prepend_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_prepend_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_prepend_function.cpp.o.d"
+  "/root/repo/src/function/list/list_range_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_range_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_range_function.cpp.o.d"
+  "/root/repo/src/function/list/list_reduce.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_reduce.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_reduce.cpp.o.d"
+  "/root/repo/src/function/list/list_reverse_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_reverse_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_reverse_function.cpp.o.d"
+  "/root/repo/src/function/list/list_single.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_single.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_single.cpp.o.d"
+  "/root/repo/src/function/list/list_slice_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_slice_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_slice_function.cpp.o.d"
+  "/root/repo/src/function/list/list_sort_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_sort_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_sort_function.cpp.o.d"
+  "/root/repo/src/function/list/list_to_string_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_to_string_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_to_string_function.cpp.o.d"
+  "/root/repo/src/function/list/list_transform.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_transform.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_transform.cpp.o.d"
+  "/root/repo/src/function/list/list_unique_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_unique_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/list_unique_function.cpp.o.d"
+  "/root/repo/src/function/list/quantifier_functions.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/quantifier_functions.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/quantifier_functions.cpp.o.d"
+  "/root/repo/src/function/list/size_function.cpp" "src/function/list/CMakeFiles/kuzu_list_function.dir/size_function.cpp.o" "gcc" "src/function/list/CMakeFiles/kuzu_list_function.dir/size_function.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
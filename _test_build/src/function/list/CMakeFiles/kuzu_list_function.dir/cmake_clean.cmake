@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_list_function.dir/list_agg_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_agg_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_all.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_all.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_any.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_any.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_any_value_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_any_value_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_append_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_append_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_concat_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_concat_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_contains_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_contains_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_creation.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_creation.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_distinct_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_distinct_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_extract_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_extract_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_filter.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_filter.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_none.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_none.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_position_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_position_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_prepend_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_prepend_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_range_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_range_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_reduce.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_reduce.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_reverse_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_reverse_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_single.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_single.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_slice_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_slice_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_sort_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_sort_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_to_string_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_to_string_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_transform.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_transform.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/list_unique_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/list_unique_function.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/quantifier_functions.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/quantifier_functions.cpp.o.d"
+  "CMakeFiles/kuzu_list_function.dir/size_function.cpp.o"
+  "CMakeFiles/kuzu_list_function.dir/size_function.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_list_function.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
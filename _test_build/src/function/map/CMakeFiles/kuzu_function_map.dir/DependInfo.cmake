@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/map/map_creation_function.cpp" "src/function/map/CMakeFiles/kuzu_function_map.dir/map_creation_function.cpp.o" "gcc" "src/function/map/CMakeFiles/kuzu_function_map.dir/map_creation_function.cpp.o.d"
+  "/root/repo/src/function/map/map_extract_function.cpp" "src/function/map/CMakeFiles/kuzu_function_map.dir/map_extract_function.cpp.o" "gcc" "src/function/map/CMakeFiles/kuzu_function_map.dir/map_extract_function.cpp.o.d"
+  "/root/repo/src/function/map/map_keys_function.cpp" "src/function/map/CMakeFiles/kuzu_function_map.dir/map_keys_function.cpp.o" "gcc" "src/function/map/CMakeFiles/kuzu_function_map.dir/map_keys_function.cpp.o.d"
+  "/root/repo/src/function/map/map_values_function.cpp" "src/function/map/CMakeFiles/kuzu_function_map.dir/map_values_function.cpp.o" "gcc" "src/function/map/CMakeFiles/kuzu_function_map.dir/map_values_function.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
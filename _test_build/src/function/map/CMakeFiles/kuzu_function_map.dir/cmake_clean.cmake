@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_map.dir/map_creation_function.cpp.o"
+  "CMakeFiles/kuzu_function_map.dir/map_creation_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_map.dir/map_extract_function.cpp.o"
+  "CMakeFiles/kuzu_function_map.dir/map_extract_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_map.dir/map_keys_function.cpp.o"
+  "CMakeFiles/kuzu_function_map.dir/map_keys_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_map.dir/map_values_function.cpp.o"
+  "CMakeFiles/kuzu_function_map.dir/map_values_function.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/path/length_function.cpp" "src/function/path/CMakeFiles/kuzu_function_path.dir/length_function.cpp.o" "gcc" "src/function/path/CMakeFiles/kuzu_function_path.dir/length_function.cpp.o.d"
+  "/root/repo/src/function/path/nodes_function.cpp" "src/function/path/CMakeFiles/kuzu_function_path.dir/nodes_function.cpp.o" "gcc" "src/function/path/CMakeFiles/kuzu_function_path.dir/nodes_function.cpp.o.d"
+  "/root/repo/src/function/path/properties_function.cpp" "src/function/path/CMakeFiles/kuzu_function_path.dir/properties_function.cpp.o" "gcc" "src/function/path/CMakeFiles/kuzu_function_path.dir/properties_function.cpp.o.d"
+  "/root/repo/src/function/path/rels_function.cpp" "src/function/path/CMakeFiles/kuzu_function_path.dir/rels_function.cpp.o" "gcc" "src/function/path/CMakeFiles/kuzu_function_path.dir/rels_function.cpp.o.d"
+  "/root/repo/src/function/path/semantic_function.cpp" "src/function/path/CMakeFiles/kuzu_function_path.dir/semantic_function.cpp.o" "gcc" "src/function/path/CMakeFiles/kuzu_function_path.dir/semantic_function.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_path.dir/length_function.cpp.o"
+  "CMakeFiles/kuzu_function_path.dir/length_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_path.dir/nodes_function.cpp.o"
+  "CMakeFiles/kuzu_function_path.dir/nodes_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_path.dir/properties_function.cpp.o"
+  "CMakeFiles/kuzu_function_path.dir/properties_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_path.dir/rels_function.cpp.o"
+  "CMakeFiles/kuzu_function_path.dir/rels_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_path.dir/semantic_function.cpp.o"
+  "CMakeFiles/kuzu_function_path.dir/semantic_function.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_path.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_pattern.dir/id_function.cpp.o"
+  "CMakeFiles/kuzu_function_pattern.dir/id_function.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_pattern.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
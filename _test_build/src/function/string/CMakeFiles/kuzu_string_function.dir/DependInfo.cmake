@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/string/init_cap_function.cpp" "src/function/string/CMakeFiles/kuzu_string_function.dir/init_cap_function.cpp.o" "gcc" "src/function/string/CMakeFiles/kuzu_string_function.dir/init_cap_function.cpp.o.d"
+  "/root/repo/src/function/string/levenshtein_function.cpp" "src/function/string/CMakeFiles/kuzu_string_function.dir/levenshtein_function.cpp.o" "gcc" "src/function/string/CMakeFiles/kuzu_string_function.dir/levenshtein_function.cpp.o.d"
+  "/root/repo/src/function/string/split_part.cpp" "src/function/string/CMakeFiles/kuzu_string_function.dir/split_part.cpp.o" "gcc" "src/function/string/CMakeFiles/kuzu_string_function.dir/split_part.cpp.o.d"
+  "/root/repo/src/function/string/string_split_function.cpp" "src/function/string/CMakeFiles/kuzu_string_function.dir/string_split_function.cpp.o" "gcc" "src/function/string/CMakeFiles/kuzu_string_function.dir/string_split_function.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
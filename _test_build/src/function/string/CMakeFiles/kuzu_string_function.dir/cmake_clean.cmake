@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_string_function.dir/init_cap_function.cpp.o"
+  "CMakeFiles/kuzu_string_function.dir/init_cap_function.cpp.o.d"
+  "CMakeFiles/kuzu_string_function.dir/levenshtein_function.cpp.o"
+  "CMakeFiles/kuzu_string_function.dir/levenshtein_function.cpp.o.d"
+  "CMakeFiles/kuzu_string_function.dir/split_part.cpp.o"
+  "CMakeFiles/kuzu_string_function.dir/split_part.cpp.o.d"
+  "CMakeFiles/kuzu_string_function.dir/string_split_function.cpp.o"
+  "CMakeFiles/kuzu_string_function.dir/string_split_function.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_string_function.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/struct/keys_function.cpp" "src/function/struct/CMakeFiles/kuzu_function_struct.dir/keys_function.cpp.o" "gcc" "src/function/struct/CMakeFiles/kuzu_function_struct.dir/keys_function.cpp.o.d"
+  "/root/repo/src/function/struct/struct_extract_function.cpp" "src/function/struct/CMakeFiles/kuzu_function_struct.dir/struct_extract_function.cpp.o" "gcc" "src/function/struct/CMakeFiles/kuzu_function_struct.dir/struct_extract_function.cpp.o.d"
+  "/root/repo/src/function/struct/struct_pack_function.cpp" "src/function/struct/CMakeFiles/kuzu_function_struct.dir/struct_pack_function.cpp.o" "gcc" "src/function/struct/CMakeFiles/kuzu_function_struct.dir/struct_pack_function.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_struct.dir/keys_function.cpp.o"
+  "CMakeFiles/kuzu_function_struct.dir/keys_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_struct.dir/struct_extract_function.cpp.o"
+  "CMakeFiles/kuzu_function_struct.dir/struct_extract_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_struct.dir/struct_pack_function.cpp.o"
+  "CMakeFiles/kuzu_function_struct.dir/struct_pack_function.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_struct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/table/bind_data.cpp" "src/function/table/CMakeFiles/kuzu_table.dir/bind_data.cpp.o" "gcc" "src/function/table/CMakeFiles/kuzu_table.dir/bind_data.cpp.o.d"
+  "/root/repo/src/function/table/call_functions.cpp" "src/function/table/CMakeFiles/kuzu_table.dir/call_functions.cpp.o" "gcc" "src/function/table/CMakeFiles/kuzu_table.dir/call_functions.cpp.o.d"
+  "/root/repo/src/function/table/scan_functions.cpp" "src/function/table/CMakeFiles/kuzu_table.dir/scan_functions.cpp.o" "gcc" "src/function/table/CMakeFiles/kuzu_table.dir/scan_functions.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_table.dir/bind_data.cpp.o"
+  "CMakeFiles/kuzu_table.dir/bind_data.cpp.o.d"
+  "CMakeFiles/kuzu_table.dir/call_functions.cpp.o"
+  "CMakeFiles/kuzu_table.dir/call_functions.cpp.o.d"
+  "CMakeFiles/kuzu_table.dir/scan_functions.cpp.o"
+  "CMakeFiles/kuzu_table.dir/scan_functions.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
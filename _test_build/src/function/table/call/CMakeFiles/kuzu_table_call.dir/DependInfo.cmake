@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/table/call/analyze.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/analyze.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/analyze.cpp.o.d"
+  "/root/repo/src/function/table/call/clear_warnings.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/clear_warnings.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/clear_warnings.cpp.o.d"
+  "/root/repo/src/function/table/call/current_setting.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/current_setting.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/current_setting.cpp.o.d"
+  "/root/repo/src/function/table/call/db_version.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/db_version.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/db_version.cpp.o.d"
+  "/root/repo/src/function/table/call/plan_cache_info.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/plan_cache_info.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/plan_cache_info.cpp.o.d"
+  "/root/repo/src/function/table/call/range_index.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/range_index.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/range_index.cpp.o.d"
+  "/root/repo/src/function/table/call/show_attached_databases.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_attached_databases.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_attached_databases.cpp.o.d"
+  "/root/repo/src/function/table/call/show_connection.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_connection.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_connection.cpp.o.d"
+  "/root/repo/src/function/table/call/show_functions.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_functions.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_functions.cpp.o.d"
+  "/root/repo/src/function/table/call/show_sequences.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_sequences.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_sequences.cpp.o.d"
+  "/root/repo/src/function/table/call/show_tables.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_tables.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_tables.cpp.o.d"
+  "/root/repo/src/function/table/call/show_warnings.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_warnings.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/show_warnings.cpp.o.d"
+  "/root/repo/src/function/table/call/storage_info.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/storage_info.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/storage_info.cpp.o.d"
+  "/root/repo/src/function/table/call/table_info.cpp" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/table_info.cpp.o" "gcc" "src/function/table/call/CMakeFiles/kuzu_table_call.dir/table_info.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
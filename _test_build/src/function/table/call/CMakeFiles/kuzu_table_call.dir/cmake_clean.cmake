@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_table_call.dir/analyze.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/analyze.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/clear_warnings.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/clear_warnings.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/current_setting.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/current_setting.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/db_version.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/db_version.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/plan_cache_info.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/plan_cache_info.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/range_index.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/range_index.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/show_attached_databases.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/show_attached_databases.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/show_connection.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/show_connection.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/show_functions.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/show_functions.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/show_sequences.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/show_sequences.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/show_tables.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/show_tables.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/show_warnings.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/show_warnings.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/storage_info.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/storage_info.cpp.o.d"
+  "CMakeFiles/kuzu_table_call.dir/table_info.cpp.o"
+  "CMakeFiles/kuzu_table_call.dir/table_info.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_table_call.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/union/union_extract_function.cpp" "src/function/union/CMakeFiles/kuzu_function_union.dir/union_extract_function.cpp.o" "gcc" "src/function/union/CMakeFiles/kuzu_function_union.dir/union_extract_function.cpp.o.d"
+  "/root/repo/src/function/union/union_tag_function.cpp" "src/function/union/CMakeFiles/kuzu_function_union.dir/union_tag_function.cpp.o" "gcc" "src/function/union/CMakeFiles/kuzu_function_union.dir/union_tag_function.cpp.o.d"
+  "/root/repo/src/function/union/union_value_function.cpp" "src/function/union/CMakeFiles/kuzu_function_union.dir/union_value_function.cpp.o" "gcc" "src/function/union/CMakeFiles/kuzu_function_union.dir/union_value_function.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
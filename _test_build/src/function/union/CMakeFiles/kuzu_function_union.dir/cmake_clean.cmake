@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_function_union.dir/union_extract_function.cpp.o"
+  "CMakeFiles/kuzu_function_union.dir/union_extract_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_union.dir/union_tag_function.cpp.o"
+  "CMakeFiles/kuzu_function_union.dir/union_tag_function.cpp.o.d"
+  "CMakeFiles/kuzu_function_union.dir/union_value_function.cpp.o"
+  "CMakeFiles/kuzu_function_union.dir/union_value_function.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_function_union.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
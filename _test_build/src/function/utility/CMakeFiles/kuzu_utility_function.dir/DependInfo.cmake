@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/function/utility/coalesce.cpp" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/coalesce.cpp.o" "gcc" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/coalesce.cpp.o.d"
+  "/root/repo/src/function/utility/constant_or_null.cpp" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/constant_or_null.cpp.o" "gcc" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/constant_or_null.cpp.o.d"
+  "/root/repo/src/function/utility/count_if.cpp" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/count_if.cpp.o" "gcc" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/count_if.cpp.o.d"
+  "/root/repo/src/function/utility/error.cpp" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/error.cpp.o" "gcc" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/error.cpp.o.d"
+  "/root/repo/src/function/utility/md5.cpp" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/md5.cpp.o" "gcc" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/md5.cpp.o.d"
+  "/root/repo/src/function/utility/nullif.cpp" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/nullif.cpp.o" "gcc" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/nullif.cpp.o.d"
+  "/root/repo/src/function/utility/sha256.cpp" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/sha256.cpp.o" "gcc" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/sha256.cpp.o.d"
+  "/root/repo/src/function/utility/typeof.cpp" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/typeof.cpp.o" "gcc" "src/function/utility/CMakeFiles/kuzu_utility_function.dir/typeof.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
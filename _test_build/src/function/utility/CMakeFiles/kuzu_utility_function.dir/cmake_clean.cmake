@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_utility_function.dir/coalesce.cpp.o"
+  "CMakeFiles/kuzu_utility_function.dir/coalesce.cpp.o.d"
+  "CMakeFiles/kuzu_utility_function.dir/constant_or_null.cpp.o"
+  "CMakeFiles/kuzu_utility_function.dir/constant_or_null.cpp.o.d"
+  "CMakeFiles/kuzu_utility_function.dir/count_if.cpp.o"
+  "CMakeFiles/kuzu_utility_function.dir/count_if.cpp.o.d"
+  "CMakeFiles/kuzu_utility_function.dir/error.cpp.o"
+  "CMakeFiles/kuzu_utility_function.dir/error.cpp.o.d"
+  "CMakeFiles/kuzu_utility_function.dir/md5.cpp.o"
+  "CMakeFiles/kuzu_utility_function.dir/md5.cpp.o.d"
+  "CMakeFiles/kuzu_utility_function.dir/nullif.cpp.o"
+  "CMakeFiles/kuzu_utility_function.dir/nullif.cpp.o.d"
+  "CMakeFiles/kuzu_utility_function.dir/sha256.cpp.o"
+  "CMakeFiles/kuzu_utility_function.dir/sha256.cpp.o.d"
+  "CMakeFiles/kuzu_utility_function.dir/typeof.cpp.o"
+  "CMakeFiles/kuzu_utility_function.dir/typeof.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_utility_function.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_graph.dir/on_disk_graph.cpp.o"
+  "CMakeFiles/kuzu_graph.dir/on_disk_graph.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_graph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
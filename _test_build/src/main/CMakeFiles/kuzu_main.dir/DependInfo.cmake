@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/main/attached_database.cpp" "src/main/CMakeFiles/kuzu_main.dir/attached_database.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/attached_database.cpp.o.d"
+  "/root/repo/src/main/client_context.cpp" "src/main/CMakeFiles/kuzu_main.dir/client_context.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/client_context.cpp.o.d"
+  "/root/repo/src/main/connection.cpp" "src/main/CMakeFiles/kuzu_main.dir/connection.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/connection.cpp.o.d"
+  "/root/repo/src/main/database.cpp" "src/main/CMakeFiles/kuzu_main.dir/database.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/database.cpp.o.d"
+  "/root/repo/src/main/database_manager.cpp" "src/main/CMakeFiles/kuzu_main.dir/database_manager.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/database_manager.cpp.o.d"
+  "/root/repo/src/main/db_config.cpp" "src/main/CMakeFiles/kuzu_main.dir/db_config.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/db_config.cpp.o.d"
+  "/root/repo/src/main/plan_cache.cpp" "src/main/CMakeFiles/kuzu_main.dir/plan_cache.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/plan_cache.cpp.o.d"
+  "/root/repo/src/main/plan_printer.cpp" "src/main/CMakeFiles/kuzu_main.dir/plan_printer.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/plan_printer.cpp.o.d"
+  "/root/repo/src/main/prepared_statement.cpp" "src/main/CMakeFiles/kuzu_main.dir/prepared_statement.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/prepared_statement.cpp.o.d"
+  "/root/repo/src/main/query_result.cpp" "src/main/CMakeFiles/kuzu_main.dir/query_result.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/query_result.cpp.o.d"
+  "/root/repo/src/main/query_summary.cpp" "src/main/CMakeFiles/kuzu_main.dir/query_summary.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/query_summary.cpp.o.d"
+  "/root/repo/src/main/storage_driver.cpp" "src/main/CMakeFiles/kuzu_main.dir/storage_driver.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/storage_driver.cpp.o.d"
+  "/root/repo/src/main/version.cpp" "src/main/CMakeFiles/kuzu_main.dir/version.cpp.o" "gcc" "src/main/CMakeFiles/kuzu_main.dir/version.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
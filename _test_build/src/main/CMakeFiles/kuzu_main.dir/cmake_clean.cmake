@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_main.dir/attached_database.cpp.o"
+  "CMakeFiles/kuzu_main.dir/attached_database.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/client_context.cpp.o"
+  "CMakeFiles/kuzu_main.dir/client_context.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/connection.cpp.o"
+  "CMakeFiles/kuzu_main.dir/connection.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/database.cpp.o"
+  "CMakeFiles/kuzu_main.dir/database.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/database_manager.cpp.o"
+  "CMakeFiles/kuzu_main.dir/database_manager.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/db_config.cpp.o"
+  "CMakeFiles/kuzu_main.dir/db_config.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/plan_cache.cpp.o"
+  "CMakeFiles/kuzu_main.dir/plan_cache.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/plan_printer.cpp.o"
+  "CMakeFiles/kuzu_main.dir/plan_printer.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/prepared_statement.cpp.o"
+  "CMakeFiles/kuzu_main.dir/prepared_statement.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/query_result.cpp.o"
+  "CMakeFiles/kuzu_main.dir/query_result.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/query_summary.cpp.o"
+  "CMakeFiles/kuzu_main.dir/query_summary.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/storage_driver.cpp.o"
+  "CMakeFiles/kuzu_main.dir/storage_driver.cpp.o.d"
+  "CMakeFiles/kuzu_main.dir/version.cpp.o"
+  "CMakeFiles/kuzu_main.dir/version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/optimizer/acc_hash_join_optimizer.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/acc_hash_join_optimizer.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/acc_hash_join_optimizer.cpp.o.d"
+  "/root/repo/src/optimizer/agg_key_dependency_optimizer.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/agg_key_dependency_optimizer.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/agg_key_dependency_optimizer.cpp.o.d"
+  "/root/repo/src/optimizer/correlated_subquery_unnest_solver.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/correlated_subquery_unnest_solver.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/correlated_subquery_unnest_solver.cpp.o.d"
+  "/root/repo/src/optimizer/factorization_rewriter.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/factorization_rewriter.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/factorization_rewriter.cpp.o.d"
+  "/root/repo/src/optimizer/filter_push_down_optimizer.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/filter_push_down_optimizer.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/filter_push_down_optimizer.cpp.o.d"
+  "/root/repo/src/optimizer/limit_push_down_optimizer.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/limit_push_down_optimizer.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/limit_push_down_optimizer.cpp.o.d"
+  "/root/repo/src/optimizer/logical_operator_collector.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/logical_operator_collector.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/logical_operator_collector.cpp.o.d"
+  "/root/repo/src/optimizer/logical_operator_visitor.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/logical_operator_visitor.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/logical_operator_visitor.cpp.o.d"
+  "/root/repo/src/optimizer/optimizer.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/optimizer.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/optimizer.cpp.o.d"
+  "/root/repo/src/optimizer/projection_push_down_optimizer.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/projection_push_down_optimizer.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/projection_push_down_optimizer.cpp.o.d"
+  "/root/repo/src/optimizer/remove_factorization_rewriter.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/remove_factorization_rewriter.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/remove_factorization_rewriter.cpp.o.d"
+  "/root/repo/src/optimizer/remove_unnecessary_join_optimizer.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/remove_unnecessary_join_optimizer.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/remove_unnecessary_join_optimizer.cpp.o.d"
+  "/root/repo/src/optimizer/top_k_optimizer.cpp" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/top_k_optimizer.cpp.o" "gcc" "src/optimizer/CMakeFiles/kuzu_optimizer.dir/top_k_optimizer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
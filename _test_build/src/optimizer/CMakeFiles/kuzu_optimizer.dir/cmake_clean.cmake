@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_optimizer.dir/acc_hash_join_optimizer.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/acc_hash_join_optimizer.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/agg_key_dependency_optimizer.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/agg_key_dependency_optimizer.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/correlated_subquery_unnest_solver.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/correlated_subquery_unnest_solver.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/factorization_rewriter.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/factorization_rewriter.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/filter_push_down_optimizer.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/filter_push_down_optimizer.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/limit_push_down_optimizer.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/limit_push_down_optimizer.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/logical_operator_collector.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/logical_operator_collector.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/logical_operator_visitor.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/logical_operator_visitor.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/optimizer.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/optimizer.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/projection_push_down_optimizer.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/projection_push_down_optimizer.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/remove_factorization_rewriter.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/remove_factorization_rewriter.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/remove_unnecessary_join_optimizer.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/remove_unnecessary_join_optimizer.cpp.o.d"
+  "CMakeFiles/kuzu_optimizer.dir/top_k_optimizer.cpp.o"
+  "CMakeFiles/kuzu_optimizer.dir/top_k_optimizer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_optimizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/parser/create_macro.cpp" "src/parser/CMakeFiles/kuzu_parser.dir/create_macro.cpp.o" "gcc" "src/parser/CMakeFiles/kuzu_parser.dir/create_macro.cpp.o.d"
+  "/root/repo/src/parser/parsed_expression_visitor.cpp" "src/parser/CMakeFiles/kuzu_parser.dir/parsed_expression_visitor.cpp.o" "gcc" "src/parser/CMakeFiles/kuzu_parser.dir/parsed_expression_visitor.cpp.o.d"
+  "/root/repo/src/parser/parsed_statement_visitor.cpp" "src/parser/CMakeFiles/kuzu_parser.dir/parsed_statement_visitor.cpp.o" "gcc" "src/parser/CMakeFiles/kuzu_parser.dir/parsed_statement_visitor.cpp.o.d"
+  "/root/repo/src/parser/parser.cpp" "src/parser/CMakeFiles/kuzu_parser.dir/parser.cpp.o" "gcc" "src/parser/CMakeFiles/kuzu_parser.dir/parser.cpp.o.d"
+  "/root/repo/src/parser/transformer.cpp" "src/parser/CMakeFiles/kuzu_parser.dir/transformer.cpp.o" "gcc" "src/parser/CMakeFiles/kuzu_parser.dir/transformer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
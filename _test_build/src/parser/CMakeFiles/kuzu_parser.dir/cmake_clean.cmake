@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_parser.dir/create_macro.cpp.o"
+  "CMakeFiles/kuzu_parser.dir/create_macro.cpp.o.d"
+  "CMakeFiles/kuzu_parser.dir/parsed_expression_visitor.cpp.o"
+  "CMakeFiles/kuzu_parser.dir/parsed_expression_visitor.cpp.o.d"
+  "CMakeFiles/kuzu_parser.dir/parsed_statement_visitor.cpp.o"
+  "CMakeFiles/kuzu_parser.dir/parsed_statement_visitor.cpp.o.d"
+  "CMakeFiles/kuzu_parser.dir/parser.cpp.o"
+  "CMakeFiles/kuzu_parser.dir/parser.cpp.o.d"
+  "CMakeFiles/kuzu_parser.dir/transformer.cpp.o"
+  "CMakeFiles/kuzu_parser.dir/transformer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/parser/antlr_parser/kuzu_cypher_parser.cpp" "src/parser/antlr_parser/CMakeFiles/kuzu_parser_antlr_parser.dir/kuzu_cypher_parser.cpp.o" "gcc" "src/parser/antlr_parser/CMakeFiles/kuzu_parser_antlr_parser.dir/kuzu_cypher_parser.cpp.o.d"
+  "/root/repo/src/parser/antlr_parser/parser_error_listener.cpp" "src/parser/antlr_parser/CMakeFiles/kuzu_parser_antlr_parser.dir/parser_error_listener.cpp.o" "gcc" "src/parser/antlr_parser/CMakeFiles/kuzu_parser_antlr_parser.dir/parser_error_listener.cpp.o.d"
+  "/root/repo/src/parser/antlr_parser/parser_error_strategy.cpp" "src/parser/antlr_parser/CMakeFiles/kuzu_parser_antlr_parser.dir/parser_error_strategy.cpp.o" "gcc" "src/parser/antlr_parser/CMakeFiles/kuzu_parser_antlr_parser.dir/parser_error_strategy.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
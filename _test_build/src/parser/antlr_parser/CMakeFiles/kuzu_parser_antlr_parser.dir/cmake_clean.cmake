@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_parser_antlr_parser.dir/kuzu_cypher_parser.cpp.o"
+  "CMakeFiles/kuzu_parser_antlr_parser.dir/kuzu_cypher_parser.cpp.o.d"
+  "CMakeFiles/kuzu_parser_antlr_parser.dir/parser_error_listener.cpp.o"
+  "CMakeFiles/kuzu_parser_antlr_parser.dir/parser_error_listener.cpp.o.d"
+  "CMakeFiles/kuzu_parser_antlr_parser.dir/parser_error_strategy.cpp.o"
+  "CMakeFiles/kuzu_parser_antlr_parser.dir/parser_error_strategy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_parser_antlr_parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/parser/expression/parsed_case_expression.cpp" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_case_expression.cpp.o" "gcc" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_case_expression.cpp.o.d"
+  "/root/repo/src/parser/expression/parsed_expression.cpp" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_expression.cpp.o" "gcc" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_expression.cpp.o.d"
+  "/root/repo/src/parser/expression/parsed_expression_visitor.cpp" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_expression_visitor.cpp.o" "gcc" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_expression_visitor.cpp.o.d"
+  "/root/repo/src/parser/expression/parsed_function_expression.cpp" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_function_expression.cpp.o" "gcc" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_function_expression.cpp.o.d"
+  "/root/repo/src/parser/expression/parsed_property_expression.cpp" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_property_expression.cpp.o" "gcc" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_property_expression.cpp.o.d"
+  "/root/repo/src/parser/expression/parsed_variable_expression.cpp" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_variable_expression.cpp.o" "gcc" "src/parser/expression/CMakeFiles/kuzu_parser_expression.dir/parsed_variable_expression.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_case_expression.cpp.o"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_case_expression.cpp.o.d"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_expression.cpp.o"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_expression.cpp.o.d"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_expression_visitor.cpp.o"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_expression_visitor.cpp.o.d"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_function_expression.cpp.o"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_function_expression.cpp.o.d"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_property_expression.cpp.o"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_property_expression.cpp.o.d"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_variable_expression.cpp.o"
+  "CMakeFiles/kuzu_parser_expression.dir/parsed_variable_expression.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_parser_expression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/parser/transform/transform_attach_database.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_attach_database.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_attach_database.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_copy.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_copy.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_copy.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_ddl.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_ddl.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_ddl.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_detach_database.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_detach_database.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_detach_database.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_expression.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_expression.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_expression.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_extension.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_extension.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_extension.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_graph_pattern.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_graph_pattern.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_graph_pattern.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_macro.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_macro.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_macro.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_port_db.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_port_db.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_port_db.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_project_graph.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_project_graph.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_project_graph.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_projection.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_projection.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_projection.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_query.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_query.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_query.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_reading_clause.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_reading_clause.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_reading_clause.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_standalone_call.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_standalone_call.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_standalone_call.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_transaction.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_transaction.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_transaction.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_updating_clause.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_updating_clause.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_updating_clause.cpp.o.d"
+  "/root/repo/src/parser/transform/transform_use_database.cpp" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_use_database.cpp.o" "gcc" "src/parser/transform/CMakeFiles/kuzu_parser_transform.dir/transform_use_database.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_parser_transform.dir/transform_attach_database.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_attach_database.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_copy.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_copy.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_ddl.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_ddl.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_detach_database.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_detach_database.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_expression.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_expression.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_extension.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_extension.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_graph_pattern.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_graph_pattern.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_macro.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_macro.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_port_db.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_port_db.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_project_graph.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_project_graph.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_projection.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_projection.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_query.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_query.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_reading_clause.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_reading_clause.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_standalone_call.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_standalone_call.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_transaction.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_transaction.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_updating_clause.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_updating_clause.cpp.o.d"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_use_database.cpp.o"
+  "CMakeFiles/kuzu_parser_transform.dir/transform_use_database.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_parser_transform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
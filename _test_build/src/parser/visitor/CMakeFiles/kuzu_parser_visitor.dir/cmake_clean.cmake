@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_parser_visitor.dir/statement_read_write_analyzer.cpp.o"
+  "CMakeFiles/kuzu_parser_visitor.dir/statement_read_write_analyzer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_parser_visitor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/planner/join_order_enumerator_context.cpp" "src/planner/CMakeFiles/kuzu_planner.dir/join_order_enumerator_context.cpp.o" "gcc" "src/planner/CMakeFiles/kuzu_planner.dir/join_order_enumerator_context.cpp.o.d"
+  "/root/repo/src/planner/planner.cpp" "src/planner/CMakeFiles/kuzu_planner.dir/planner.cpp.o" "gcc" "src/planner/CMakeFiles/kuzu_planner.dir/planner.cpp.o.d"
+  "/root/repo/src/planner/query_planner.cpp" "src/planner/CMakeFiles/kuzu_planner.dir/query_planner.cpp.o" "gcc" "src/planner/CMakeFiles/kuzu_planner.dir/query_planner.cpp.o.d"
+  "/root/repo/src/planner/subplans_table.cpp" "src/planner/CMakeFiles/kuzu_planner.dir/subplans_table.cpp.o" "gcc" "src/planner/CMakeFiles/kuzu_planner.dir/subplans_table.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
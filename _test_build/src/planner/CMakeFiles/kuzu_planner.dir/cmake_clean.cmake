@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_planner.dir/join_order_enumerator_context.cpp.o"
+  "CMakeFiles/kuzu_planner.dir/join_order_enumerator_context.cpp.o.d"
+  "CMakeFiles/kuzu_planner.dir/planner.cpp.o"
+  "CMakeFiles/kuzu_planner.dir/planner.cpp.o.d"
+  "CMakeFiles/kuzu_planner.dir/query_planner.cpp.o"
+  "CMakeFiles/kuzu_planner.dir/query_planner.cpp.o.d"
+  "CMakeFiles/kuzu_planner.dir/subplans_table.cpp.o"
+  "CMakeFiles/kuzu_planner.dir/subplans_table.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_planner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/planner/join_order/cardinality_estimator.cpp" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/cardinality_estimator.cpp.o" "gcc" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/cardinality_estimator.cpp.o.d"
+  "/root/repo/src/planner/join_order/cost_model.cpp" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/cost_model.cpp.o" "gcc" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/cost_model.cpp.o.d"
+  "/root/repo/src/planner/join_order/join_order_util.cpp" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/join_order_util.cpp.o" "gcc" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/join_order_util.cpp.o.d"
+  "/root/repo/src/planner/join_order/join_plan_solver.cpp" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/join_plan_solver.cpp.o" "gcc" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/join_plan_solver.cpp.o.d"
+  "/root/repo/src/planner/join_order/join_tree.cpp" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/join_tree.cpp.o" "gcc" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/join_tree.cpp.o.d"
+  "/root/repo/src/planner/join_order/join_tree_constructor.cpp" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/join_tree_constructor.cpp.o" "gcc" "src/planner/join_order/CMakeFiles/kuzu_planner_join_order.dir/join_tree_constructor.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_planner_join_order.dir/cardinality_estimator.cpp.o"
+  "CMakeFiles/kuzu_planner_join_order.dir/cardinality_estimator.cpp.o.d"
+  "CMakeFiles/kuzu_planner_join_order.dir/cost_model.cpp.o"
+  "CMakeFiles/kuzu_planner_join_order.dir/cost_model.cpp.o.d"
+  "CMakeFiles/kuzu_planner_join_order.dir/join_order_util.cpp.o"
+  "CMakeFiles/kuzu_planner_join_order.dir/join_order_util.cpp.o.d"
+  "CMakeFiles/kuzu_planner_join_order.dir/join_plan_solver.cpp.o"
+  "CMakeFiles/kuzu_planner_join_order.dir/join_plan_solver.cpp.o.d"
+  "CMakeFiles/kuzu_planner_join_order.dir/join_tree.cpp.o"
+  "CMakeFiles/kuzu_planner_join_order.dir/join_tree.cpp.o.d"
+  "CMakeFiles/kuzu_planner_join_order.dir/join_tree_constructor.cpp.o"
+  "CMakeFiles/kuzu_planner_join_order.dir/join_tree_constructor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_planner_join_order.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/planner/operator/logical_accumulate.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_accumulate.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_accumulate.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_aggregate.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_aggregate.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_aggregate.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_create_macro.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_create_macro.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_create_macro.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_cross_product.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_cross_product.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_cross_product.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_distinct.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_distinct.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_distinct.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_dummy_scan.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_dummy_scan.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_dummy_scan.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_explain.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_explain.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_explain.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_filter.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_filter.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_filter.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_flatten.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_flatten.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_flatten.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_gds_call.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_gds_call.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_gds_call.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_hash_join.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_hash_join.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_hash_join.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_intersect.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_intersect.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_intersect.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_limit.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_limit.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_limit.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_operator.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_operator.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_operator.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_order_by.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_order_by.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_order_by.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_partitioner.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_partitioner.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_partitioner.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_plan.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_plan.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_plan.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_plan_util.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_plan_util.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_plan_util.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_projection.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_projection.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_projection.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_table_function_call.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_table_function_call.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_table_function_call.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_union.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_union.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_union.cpp.o.d"
+  "/root/repo/src/planner/operator/logical_unwind.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_unwind.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/logical_unwind.cpp.o.d"
+  "/root/repo/src/planner/operator/schema.cpp" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/schema.cpp.o" "gcc" "src/planner/operator/CMakeFiles/kuzu_planner_operator.dir/schema.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
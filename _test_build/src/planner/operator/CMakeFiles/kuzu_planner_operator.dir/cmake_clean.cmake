@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_planner_operator.dir/logical_accumulate.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_accumulate.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_aggregate.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_aggregate.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_create_macro.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_create_macro.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_cross_product.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_cross_product.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_distinct.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_distinct.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_dummy_scan.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_dummy_scan.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_explain.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_explain.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_filter.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_filter.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_flatten.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_flatten.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_gds_call.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_gds_call.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_hash_join.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_hash_join.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_intersect.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_intersect.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_limit.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_limit.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_operator.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_operator.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_order_by.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_order_by.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_partitioner.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_partitioner.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_plan.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_plan.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_plan_util.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_plan_util.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_projection.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_projection.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_table_function_call.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_table_function_call.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_union.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_union.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_unwind.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/logical_unwind.cpp.o.d"
+  "CMakeFiles/kuzu_planner_operator.dir/schema.cpp.o"
+  "CMakeFiles/kuzu_planner_operator.dir/schema.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_planner_operator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
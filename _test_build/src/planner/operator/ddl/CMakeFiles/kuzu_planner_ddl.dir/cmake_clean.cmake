@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_planner_ddl.dir/logical_ddl.cpp.o"
+  "CMakeFiles/kuzu_planner_ddl.dir/logical_ddl.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_planner_ddl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
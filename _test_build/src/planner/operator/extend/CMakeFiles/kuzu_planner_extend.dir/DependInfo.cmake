@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/planner/operator/extend/base_logical_extend.cpp" "src/planner/operator/extend/CMakeFiles/kuzu_planner_extend.dir/base_logical_extend.cpp.o" "gcc" "src/planner/operator/extend/CMakeFiles/kuzu_planner_extend.dir/base_logical_extend.cpp.o.d"
+  "/root/repo/src/planner/operator/extend/logical_extend.cpp" "src/planner/operator/extend/CMakeFiles/kuzu_planner_extend.dir/logical_extend.cpp.o" "gcc" "src/planner/operator/extend/CMakeFiles/kuzu_planner_extend.dir/logical_extend.cpp.o.d"
+  "/root/repo/src/planner/operator/extend/logical_recursive_extend.cpp" "src/planner/operator/extend/CMakeFiles/kuzu_planner_extend.dir/logical_recursive_extend.cpp.o" "gcc" "src/planner/operator/extend/CMakeFiles/kuzu_planner_extend.dir/logical_recursive_extend.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_planner_extend.dir/base_logical_extend.cpp.o"
+  "CMakeFiles/kuzu_planner_extend.dir/base_logical_extend.cpp.o.d"
+  "CMakeFiles/kuzu_planner_extend.dir/logical_extend.cpp.o"
+  "CMakeFiles/kuzu_planner_extend.dir/logical_extend.cpp.o.d"
+  "CMakeFiles/kuzu_planner_extend.dir/logical_recursive_extend.cpp.o"
+  "CMakeFiles/kuzu_planner_extend.dir/logical_recursive_extend.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_planner_extend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
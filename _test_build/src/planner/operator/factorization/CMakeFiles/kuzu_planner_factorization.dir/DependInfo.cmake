@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/planner/operator/factorization/flatten_resolver.cpp" "src/planner/operator/factorization/CMakeFiles/kuzu_planner_factorization.dir/flatten_resolver.cpp.o" "gcc" "src/planner/operator/factorization/CMakeFiles/kuzu_planner_factorization.dir/flatten_resolver.cpp.o.d"
+  "/root/repo/src/planner/operator/factorization/sink_util.cpp" "src/planner/operator/factorization/CMakeFiles/kuzu_planner_factorization.dir/sink_util.cpp.o" "gcc" "src/planner/operator/factorization/CMakeFiles/kuzu_planner_factorization.dir/sink_util.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
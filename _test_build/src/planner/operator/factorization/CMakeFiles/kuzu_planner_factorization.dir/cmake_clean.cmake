@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_planner_factorization.dir/flatten_resolver.cpp.o"
+  "CMakeFiles/kuzu_planner_factorization.dir/flatten_resolver.cpp.o.d"
+  "CMakeFiles/kuzu_planner_factorization.dir/sink_util.cpp.o"
+  "CMakeFiles/kuzu_planner_factorization.dir/sink_util.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_planner_factorization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
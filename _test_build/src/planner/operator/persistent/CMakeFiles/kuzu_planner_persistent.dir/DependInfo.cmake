@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/planner/operator/persistent/logical_copy_from.cpp" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_copy_from.cpp.o" "gcc" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_copy_from.cpp.o.d"
+  "/root/repo/src/planner/operator/persistent/logical_copy_to.cpp" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_copy_to.cpp.o" "gcc" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_copy_to.cpp.o.d"
+  "/root/repo/src/planner/operator/persistent/logical_delete.cpp" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_delete.cpp.o" "gcc" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_delete.cpp.o.d"
+  "/root/repo/src/planner/operator/persistent/logical_insert.cpp" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_insert.cpp.o" "gcc" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_insert.cpp.o.d"
+  "/root/repo/src/planner/operator/persistent/logical_merge.cpp" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_merge.cpp.o" "gcc" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_merge.cpp.o.d"
+  "/root/repo/src/planner/operator/persistent/logical_set.cpp" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_set.cpp.o" "gcc" "src/planner/operator/persistent/CMakeFiles/kuzu_planner_persistent.dir/logical_set.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
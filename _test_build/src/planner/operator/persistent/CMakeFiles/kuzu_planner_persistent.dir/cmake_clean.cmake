@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_copy_from.cpp.o"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_copy_from.cpp.o.d"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_copy_to.cpp.o"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_copy_to.cpp.o.d"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_delete.cpp.o"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_delete.cpp.o.d"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_insert.cpp.o"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_insert.cpp.o.d"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_merge.cpp.o"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_merge.cpp.o.d"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_set.cpp.o"
+  "CMakeFiles/kuzu_planner_persistent.dir/logical_set.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_planner_persistent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/planner/operator/scan/logical_expressions_scan.cpp" "src/planner/operator/scan/CMakeFiles/kuzu_planner_scan.dir/logical_expressions_scan.cpp.o" "gcc" "src/planner/operator/scan/CMakeFiles/kuzu_planner_scan.dir/logical_expressions_scan.cpp.o.d"
+  "/root/repo/src/planner/operator/scan/logical_index_look_up.cpp" "src/planner/operator/scan/CMakeFiles/kuzu_planner_scan.dir/logical_index_look_up.cpp.o" "gcc" "src/planner/operator/scan/CMakeFiles/kuzu_planner_scan.dir/logical_index_look_up.cpp.o.d"
+  "/root/repo/src/planner/operator/scan/logical_scan_node_table.cpp" "src/planner/operator/scan/CMakeFiles/kuzu_planner_scan.dir/logical_scan_node_table.cpp.o" "gcc" "src/planner/operator/scan/CMakeFiles/kuzu_planner_scan.dir/logical_scan_node_table.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_planner_scan.dir/logical_expressions_scan.cpp.o"
+  "CMakeFiles/kuzu_planner_scan.dir/logical_expressions_scan.cpp.o.d"
+  "CMakeFiles/kuzu_planner_scan.dir/logical_index_look_up.cpp.o"
+  "CMakeFiles/kuzu_planner_scan.dir/logical_index_look_up.cpp.o.d"
+  "CMakeFiles/kuzu_planner_scan.dir/logical_scan_node_table.cpp.o"
+  "CMakeFiles/kuzu_planner_scan.dir/logical_scan_node_table.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_planner_scan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
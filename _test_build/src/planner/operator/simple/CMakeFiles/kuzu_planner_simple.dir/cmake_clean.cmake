@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_planner_simple.dir/logical_simple.cpp.o"
+  "CMakeFiles/kuzu_planner_simple.dir/logical_simple.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_planner_simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,49 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/planner/plan/append_accumulate.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_accumulate.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_accumulate.cpp.o.d"
+  "/root/repo/src/planner/plan/append_aggregate.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_aggregate.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_aggregate.cpp.o.d"
+  "/root/repo/src/planner/plan/append_cross_product.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_cross_product.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_cross_product.cpp.o.d"
+  "/root/repo/src/planner/plan/append_delete.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_delete.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_delete.cpp.o.d"
+  "/root/repo/src/planner/plan/append_distinct.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_distinct.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_distinct.cpp.o.d"
+  "/root/repo/src/planner/plan/append_dummy_scan.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_dummy_scan.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_dummy_scan.cpp.o.d"
+  "/root/repo/src/planner/plan/append_empty_result.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_empty_result.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_empty_result.cpp.o.d"
+  "/root/repo/src/planner/plan/append_expressions_scan.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_expressions_scan.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_expressions_scan.cpp.o.d"
+  "/root/repo/src/planner/plan/append_extend.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_extend.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_extend.cpp.o.d"
+  "/root/repo/src/planner/plan/append_filter.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_filter.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_filter.cpp.o.d"
+  "/root/repo/src/planner/plan/append_flatten.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_flatten.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_flatten.cpp.o.d"
+  "/root/repo/src/planner/plan/append_gds_call.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_gds_call.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_gds_call.cpp.o.d"
+  "/root/repo/src/planner/plan/append_insert.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_insert.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_insert.cpp.o.d"
+  "/root/repo/src/planner/plan/append_join.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_join.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_join.cpp.o.d"
+  "/root/repo/src/planner/plan/append_limit.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_limit.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_limit.cpp.o.d"
+  "/root/repo/src/planner/plan/append_multiplicity_reducer.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_multiplicity_reducer.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_multiplicity_reducer.cpp.o.d"
+  "/root/repo/src/planner/plan/append_order_by.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_order_by.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_order_by.cpp.o.d"
+  "/root/repo/src/planner/plan/append_projection.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_projection.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_projection.cpp.o.d"
+  "/root/repo/src/planner/plan/append_scan_node_table.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_scan_node_table.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_scan_node_table.cpp.o.d"
+  "/root/repo/src/planner/plan/append_set.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_set.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_set.cpp.o.d"
+  "/root/repo/src/planner/plan/append_simple.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_simple.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_simple.cpp.o.d"
+  "/root/repo/src/planner/plan/append_table_function_call.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_table_function_call.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_table_function_call.cpp.o.d"
+  "/root/repo/src/planner/plan/append_unwind.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_unwind.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/append_unwind.cpp.o.d"
+  "/root/repo/src/planner/plan/plan_copy.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_copy.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_copy.cpp.o.d"
+  "/root/repo/src/planner/plan/plan_join_order.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_join_order.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_join_order.cpp.o.d"
+  "/root/repo/src/planner/plan/plan_port_db.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_port_db.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_port_db.cpp.o.d"
+  "/root/repo/src/planner/plan/plan_projection.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_projection.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_projection.cpp.o.d"
+  "/root/repo/src/planner/plan/plan_read.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_read.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_read.cpp.o.d"
+  "/root/repo/src/planner/plan/plan_single_query.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_single_query.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_single_query.cpp.o.d"
+  "/root/repo/src/planner/plan/plan_subquery.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_subquery.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_subquery.cpp.o.d"
+  "/root/repo/src/planner/plan/plan_update.cpp" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_update.cpp.o" "gcc" "src/planner/plan/CMakeFiles/kuzu_planner_plan_operator.dir/plan_update.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_accumulate.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_accumulate.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_aggregate.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_aggregate.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_cross_product.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_cross_product.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_delete.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_delete.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_distinct.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_distinct.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_dummy_scan.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_dummy_scan.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_empty_result.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_empty_result.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_expressions_scan.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_expressions_scan.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_extend.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_extend.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_filter.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_filter.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_flatten.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_flatten.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_gds_call.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_gds_call.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_insert.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_insert.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_join.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_join.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_limit.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_limit.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_multiplicity_reducer.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_multiplicity_reducer.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_order_by.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_order_by.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_projection.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_projection.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_scan_node_table.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_scan_node_table.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_set.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_set.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_simple.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_simple.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_table_function_call.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_table_function_call.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_unwind.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/append_unwind.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_copy.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_copy.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_join_order.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_join_order.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_port_db.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_port_db.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_projection.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_projection.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_read.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_read.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_single_query.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_single_query.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_subquery.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_subquery.cpp.o.d"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_update.cpp.o"
+  "CMakeFiles/kuzu_planner_plan_operator.dir/plan_update.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_planner_plan_operator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/execution_context.cpp" "src/processor/CMakeFiles/kuzu_processor.dir/execution_context.cpp.o" "gcc" "src/processor/CMakeFiles/kuzu_processor.dir/execution_context.cpp.o.d"
+  "/root/repo/src/processor/processor.cpp" "src/processor/CMakeFiles/kuzu_processor.dir/processor.cpp.o" "gcc" "src/processor/CMakeFiles/kuzu_processor.dir/processor.cpp.o.d"
+  "/root/repo/src/processor/processor_task.cpp" "src/processor/CMakeFiles/kuzu_processor.dir/processor_task.cpp.o" "gcc" "src/processor/CMakeFiles/kuzu_processor.dir/processor_task.cpp.o.d"
+  "/root/repo/src/processor/warning_context.cpp" "src/processor/CMakeFiles/kuzu_processor.dir/warning_context.cpp.o" "gcc" "src/processor/CMakeFiles/kuzu_processor.dir/warning_context.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
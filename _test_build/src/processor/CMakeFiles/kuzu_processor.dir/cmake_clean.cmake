@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor.dir/execution_context.cpp.o"
+  "CMakeFiles/kuzu_processor.dir/execution_context.cpp.o.d"
+  "CMakeFiles/kuzu_processor.dir/processor.cpp.o"
+  "CMakeFiles/kuzu_processor.dir/processor.cpp.o.d"
+  "CMakeFiles/kuzu_processor.dir/processor_task.cpp.o"
+  "CMakeFiles/kuzu_processor.dir/processor_task.cpp.o.d"
+  "CMakeFiles/kuzu_processor.dir/warning_context.cpp.o"
+  "CMakeFiles/kuzu_processor.dir/warning_context.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/map/create_factorized_table_scan.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/create_factorized_table_scan.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/create_factorized_table_scan.cpp.o.d"
+  "/root/repo/src/processor/map/create_result_collector.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/create_result_collector.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/create_result_collector.cpp.o.d"
+  "/root/repo/src/processor/map/expression_mapper.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/expression_mapper.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/expression_mapper.cpp.o.d"
+  "/root/repo/src/processor/map/map_acc_hash_join.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_acc_hash_join.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_acc_hash_join.cpp.o.d"
+  "/root/repo/src/processor/map/map_accumulate.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_accumulate.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_accumulate.cpp.o.d"
+  "/root/repo/src/processor/map/map_aggregate.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_aggregate.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_aggregate.cpp.o.d"
+  "/root/repo/src/processor/map/map_copy_from.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_copy_from.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_copy_from.cpp.o.d"
+  "/root/repo/src/processor/map/map_copy_to.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_copy_to.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_copy_to.cpp.o.d"
+  "/root/repo/src/processor/map/map_create_macro.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_create_macro.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_create_macro.cpp.o.d"
+  "/root/repo/src/processor/map/map_cross_product.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_cross_product.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_cross_product.cpp.o.d"
+  "/root/repo/src/processor/map/map_ddl.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_ddl.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_ddl.cpp.o.d"
+  "/root/repo/src/processor/map/map_delete.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_delete.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_delete.cpp.o.d"
+  "/root/repo/src/processor/map/map_distinct.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_distinct.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_distinct.cpp.o.d"
+  "/root/repo/src/processor/map/map_dummy_scan.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_dummy_scan.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_dummy_scan.cpp.o.d"
+  "/root/repo/src/processor/map/map_empty_result.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_empty_result.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_empty_result.cpp.o.d"
+  "/root/repo/src/processor/map/map_explain.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_explain.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_explain.cpp.o.d"
+  "/root/repo/src/processor/map/map_expressions_scan.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_expressions_scan.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_expressions_scan.cpp.o.d"
+  "/root/repo/src/processor/map/map_extend.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_extend.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_extend.cpp.o.d"
+  "/root/repo/src/processor/map/map_filter.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_filter.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_filter.cpp.o.d"
+  "/root/repo/src/processor/map/map_flatten.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_flatten.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_flatten.cpp.o.d"
+  "/root/repo/src/processor/map/map_gds.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_gds.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_gds.cpp.o.d"
+  "/root/repo/src/processor/map/map_hash_join.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_hash_join.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_hash_join.cpp.o.d"
+  "/root/repo/src/processor/map/map_index_scan_node.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_index_scan_node.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_index_scan_node.cpp.o.d"
+  "/root/repo/src/processor/map/map_insert.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_insert.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_insert.cpp.o.d"
+  "/root/repo/src/processor/map/map_intersect.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_intersect.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_intersect.cpp.o.d"
+  "/root/repo/src/processor/map/map_label_filter.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_label_filter.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_label_filter.cpp.o.d"
+  "/root/repo/src/processor/map/map_limit.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_limit.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_limit.cpp.o.d"
+  "/root/repo/src/processor/map/map_merge.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_merge.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_merge.cpp.o.d"
+  "/root/repo/src/processor/map/map_multiplicity_reducer.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_multiplicity_reducer.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_multiplicity_reducer.cpp.o.d"
+  "/root/repo/src/processor/map/map_order_by.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_order_by.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_order_by.cpp.o.d"
+  "/root/repo/src/processor/map/map_path_property_probe.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_path_property_probe.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_path_property_probe.cpp.o.d"
+  "/root/repo/src/processor/map/map_projection.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_projection.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_projection.cpp.o.d"
+  "/root/repo/src/processor/map/map_recursive_extend.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_recursive_extend.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_recursive_extend.cpp.o.d"
+  "/root/repo/src/processor/map/map_scan_node_table.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_scan_node_table.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_scan_node_table.cpp.o.d"
+  "/root/repo/src/processor/map/map_semi_masker.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_semi_masker.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_semi_masker.cpp.o.d"
+  "/root/repo/src/processor/map/map_set.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_set.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_set.cpp.o.d"
+  "/root/repo/src/processor/map/map_simple.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_simple.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_simple.cpp.o.d"
+  "/root/repo/src/processor/map/map_standalone_call.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_standalone_call.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_standalone_call.cpp.o.d"
+  "/root/repo/src/processor/map/map_table_function_call.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_table_function_call.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_table_function_call.cpp.o.d"
+  "/root/repo/src/processor/map/map_transaction.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_transaction.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_transaction.cpp.o.d"
+  "/root/repo/src/processor/map/map_union.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_union.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_union.cpp.o.d"
+  "/root/repo/src/processor/map/map_unwind.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_unwind.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/map_unwind.cpp.o.d"
+  "/root/repo/src/processor/map/plan_mapper.cpp" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/plan_mapper.cpp.o" "gcc" "src/processor/map/CMakeFiles/kuzu_processor_mapper.dir/plan_mapper.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,93 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_mapper.dir/create_factorized_table_scan.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/create_factorized_table_scan.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/create_result_collector.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/create_result_collector.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/expression_mapper.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/expression_mapper.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_acc_hash_join.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_acc_hash_join.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_accumulate.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_accumulate.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_aggregate.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_aggregate.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_copy_from.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_copy_from.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_copy_to.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_copy_to.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_create_macro.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_create_macro.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_cross_product.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_cross_product.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_ddl.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_ddl.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_delete.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_delete.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_distinct.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_distinct.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_dummy_scan.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_dummy_scan.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_empty_result.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_empty_result.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_explain.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_explain.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_expressions_scan.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_expressions_scan.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_extend.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_extend.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_filter.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_filter.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_flatten.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_flatten.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_gds.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_gds.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_hash_join.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_hash_join.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_index_scan_node.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_index_scan_node.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_insert.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_insert.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_intersect.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_intersect.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_label_filter.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_label_filter.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_limit.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_limit.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_merge.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_merge.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_multiplicity_reducer.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_multiplicity_reducer.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_order_by.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_order_by.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_path_property_probe.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_path_property_probe.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_projection.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_projection.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_recursive_extend.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_recursive_extend.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_scan_node_table.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_scan_node_table.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_semi_masker.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_semi_masker.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_set.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_set.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_simple.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_simple.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_standalone_call.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_standalone_call.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_table_function_call.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_table_function_call.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_transaction.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_transaction.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_union.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_union.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_unwind.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/map_unwind.cpp.o.d"
+  "CMakeFiles/kuzu_processor_mapper.dir/plan_mapper.cpp.o"
+  "CMakeFiles/kuzu_processor_mapper.dir/plan_mapper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_mapper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/cross_product.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/cross_product.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/cross_product.cpp.o.d"
+  "/root/repo/src/processor/operator/empty_result.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/empty_result.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/empty_result.cpp.o.d"
+  "/root/repo/src/processor/operator/filter.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/filter.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/filter.cpp.o.d"
+  "/root/repo/src/processor/operator/filtering_operator.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/filtering_operator.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/filtering_operator.cpp.o.d"
+  "/root/repo/src/processor/operator/flatten.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/flatten.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/flatten.cpp.o.d"
+  "/root/repo/src/processor/operator/gds_call.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/gds_call.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/gds_call.cpp.o.d"
+  "/root/repo/src/processor/operator/index_lookup.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/index_lookup.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/index_lookup.cpp.o.d"
+  "/root/repo/src/processor/operator/limit.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/limit.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/limit.cpp.o.d"
+  "/root/repo/src/processor/operator/multiplicity_reducer.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/multiplicity_reducer.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/multiplicity_reducer.cpp.o.d"
+  "/root/repo/src/processor/operator/partitioner.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/partitioner.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/partitioner.cpp.o.d"
+  "/root/repo/src/processor/operator/physical_operator.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/physical_operator.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/physical_operator.cpp.o.d"
+  "/root/repo/src/processor/operator/profile.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/profile.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/profile.cpp.o.d"
+  "/root/repo/src/processor/operator/projection.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/projection.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/projection.cpp.o.d"
+  "/root/repo/src/processor/operator/result_collector.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/result_collector.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/result_collector.cpp.o.d"
+  "/root/repo/src/processor/operator/semi_masker.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/semi_masker.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/semi_masker.cpp.o.d"
+  "/root/repo/src/processor/operator/skip.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/skip.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/skip.cpp.o.d"
+  "/root/repo/src/processor/operator/standalone_call.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/standalone_call.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/standalone_call.cpp.o.d"
+  "/root/repo/src/processor/operator/table_function_call.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/table_function_call.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/table_function_call.cpp.o.d"
+  "/root/repo/src/processor/operator/transaction.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/transaction.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/transaction.cpp.o.d"
+  "/root/repo/src/processor/operator/unwind.cpp" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/unwind.cpp.o" "gcc" "src/processor/operator/CMakeFiles/kuzu_processor_operator.dir/unwind.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
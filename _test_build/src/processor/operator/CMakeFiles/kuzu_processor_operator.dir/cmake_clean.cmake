@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator.dir/cross_product.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/cross_product.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/empty_result.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/empty_result.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/filter.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/filter.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/filtering_operator.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/filtering_operator.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/flatten.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/flatten.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/gds_call.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/gds_call.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/index_lookup.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/index_lookup.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/limit.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/limit.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/multiplicity_reducer.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/multiplicity_reducer.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/partitioner.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/partitioner.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/physical_operator.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/physical_operator.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/profile.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/profile.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/projection.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/projection.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/result_collector.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/result_collector.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/semi_masker.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/semi_masker.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/skip.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/skip.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/standalone_call.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/standalone_call.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/table_function_call.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/table_function_call.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/transaction.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/transaction.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator.dir/unwind.cpp.o"
+  "CMakeFiles/kuzu_processor_operator.dir/unwind.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/aggregate/aggregate_hash_table.cpp" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/aggregate_hash_table.cpp.o" "gcc" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/aggregate_hash_table.cpp.o.d"
+  "/root/repo/src/processor/operator/aggregate/base_aggregate.cpp" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/base_aggregate.cpp.o" "gcc" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/base_aggregate.cpp.o.d"
+  "/root/repo/src/processor/operator/aggregate/base_aggregate_scan.cpp" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/base_aggregate_scan.cpp.o" "gcc" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/base_aggregate_scan.cpp.o.d"
+  "/root/repo/src/processor/operator/aggregate/hash_aggregate.cpp" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/hash_aggregate.cpp.o" "gcc" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/hash_aggregate.cpp.o.d"
+  "/root/repo/src/processor/operator/aggregate/hash_aggregate_scan.cpp" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/hash_aggregate_scan.cpp.o" "gcc" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/hash_aggregate_scan.cpp.o.d"
+  "/root/repo/src/processor/operator/aggregate/simple_aggregate.cpp" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/simple_aggregate.cpp.o" "gcc" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/simple_aggregate.cpp.o.d"
+  "/root/repo/src/processor/operator/aggregate/simple_aggregate_scan.cpp" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/simple_aggregate_scan.cpp.o" "gcc" "src/processor/operator/aggregate/CMakeFiles/kuzu_processor_operator_aggregate.dir/simple_aggregate_scan.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/aggregate_hash_table.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/aggregate_hash_table.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/base_aggregate.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/base_aggregate.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/base_aggregate_scan.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/base_aggregate_scan.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/hash_aggregate.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/hash_aggregate.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/hash_aggregate_scan.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/hash_aggregate_scan.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/simple_aggregate.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/simple_aggregate.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/simple_aggregate_scan.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_aggregate.dir/simple_aggregate_scan.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_aggregate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
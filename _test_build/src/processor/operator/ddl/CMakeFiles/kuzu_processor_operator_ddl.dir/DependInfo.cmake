@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/ddl/alter.cpp" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/alter.cpp.o" "gcc" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/alter.cpp.o.d"
+  "/root/repo/src/processor/operator/ddl/create_sequence.cpp" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/create_sequence.cpp.o" "gcc" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/create_sequence.cpp.o.d"
+  "/root/repo/src/processor/operator/ddl/create_table.cpp" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/create_table.cpp.o" "gcc" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/create_table.cpp.o.d"
+  "/root/repo/src/processor/operator/ddl/create_type.cpp" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/create_type.cpp.o" "gcc" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/create_type.cpp.o.d"
+  "/root/repo/src/processor/operator/ddl/ddl.cpp" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/ddl.cpp.o" "gcc" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/ddl.cpp.o.d"
+  "/root/repo/src/processor/operator/ddl/drop.cpp" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/drop.cpp.o" "gcc" "src/processor/operator/ddl/CMakeFiles/kuzu_processor_operator_ddl.dir/drop.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
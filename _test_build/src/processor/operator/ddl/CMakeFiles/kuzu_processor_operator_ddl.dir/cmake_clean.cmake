@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/alter.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/alter.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/create_sequence.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/create_sequence.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/create_table.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/create_table.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/create_type.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/create_type.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/ddl.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/ddl.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/drop.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_ddl.dir/drop.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_ddl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/hash_join/hash_join_build.cpp" "src/processor/operator/hash_join/CMakeFiles/kuzu_processor_operator_hash_join.dir/hash_join_build.cpp.o" "gcc" "src/processor/operator/hash_join/CMakeFiles/kuzu_processor_operator_hash_join.dir/hash_join_build.cpp.o.d"
+  "/root/repo/src/processor/operator/hash_join/hash_join_probe.cpp" "src/processor/operator/hash_join/CMakeFiles/kuzu_processor_operator_hash_join.dir/hash_join_probe.cpp.o" "gcc" "src/processor/operator/hash_join/CMakeFiles/kuzu_processor_operator_hash_join.dir/hash_join_probe.cpp.o.d"
+  "/root/repo/src/processor/operator/hash_join/join_hash_table.cpp" "src/processor/operator/hash_join/CMakeFiles/kuzu_processor_operator_hash_join.dir/join_hash_table.cpp.o" "gcc" "src/processor/operator/hash_join/CMakeFiles/kuzu_processor_operator_hash_join.dir/join_hash_table.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
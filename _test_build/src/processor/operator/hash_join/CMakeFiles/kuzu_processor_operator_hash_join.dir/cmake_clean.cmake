@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_hash_join.dir/hash_join_build.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_hash_join.dir/hash_join_build.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_hash_join.dir/hash_join_probe.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_hash_join.dir/hash_join_probe.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_hash_join.dir/join_hash_table.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_hash_join.dir/join_hash_table.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_hash_join.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
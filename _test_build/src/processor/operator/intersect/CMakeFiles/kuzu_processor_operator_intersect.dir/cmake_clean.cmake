@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_intersect.dir/intersect.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_intersect.dir/intersect.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_intersect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_create_macro.dir/create_macro.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_create_macro.dir/create_macro.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_create_macro.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/order_by/key_block_merger.cpp" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/key_block_merger.cpp.o" "gcc" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/key_block_merger.cpp.o.d"
+  "/root/repo/src/processor/operator/order_by/order_by.cpp" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/order_by.cpp.o" "gcc" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/order_by.cpp.o.d"
+  "/root/repo/src/processor/operator/order_by/order_by_key_encoder.cpp" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_key_encoder.cpp.o" "gcc" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_key_encoder.cpp.o.d"
+  "/root/repo/src/processor/operator/order_by/order_by_merge.cpp" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_merge.cpp.o" "gcc" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_merge.cpp.o.d"
+  "/root/repo/src/processor/operator/order_by/order_by_scan.cpp" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_scan.cpp.o" "gcc" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_scan.cpp.o.d"
+  "/root/repo/src/processor/operator/order_by/radix_sort.cpp" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/radix_sort.cpp.o" "gcc" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/radix_sort.cpp.o.d"
+  "/root/repo/src/processor/operator/order_by/sort_state.cpp" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/sort_state.cpp.o" "gcc" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/sort_state.cpp.o.d"
+  "/root/repo/src/processor/operator/order_by/top_k.cpp" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/top_k.cpp.o" "gcc" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/top_k.cpp.o.d"
+  "/root/repo/src/processor/operator/order_by/top_k_scanner.cpp" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/top_k_scanner.cpp.o" "gcc" "src/processor/operator/order_by/CMakeFiles/kuzu_processor_operator_order_by.dir/top_k_scanner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
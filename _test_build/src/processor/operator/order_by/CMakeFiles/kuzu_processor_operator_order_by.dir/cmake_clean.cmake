@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/key_block_merger.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/key_block_merger.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/order_by.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/order_by.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_key_encoder.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_key_encoder.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_merge.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_merge.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_scan.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/order_by_scan.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/radix_sort.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/radix_sort.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/sort_state.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/sort_state.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/top_k.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/top_k.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/top_k_scanner.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_order_by.dir/top_k_scanner.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_order_by.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/persistent/batch_insert_error_handler.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/batch_insert_error_handler.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/batch_insert_error_handler.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/copy_rdf.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/copy_rdf.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/copy_rdf.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/copy_to.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/copy_to.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/copy_to.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/delete.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/delete.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/delete.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/delete_executor.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/delete_executor.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/delete_executor.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/index_builder.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/index_builder.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/index_builder.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/insert.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/insert.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/insert.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/insert_executor.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/insert_executor.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/insert_executor.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/merge.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/merge.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/merge.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/node_batch_insert.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/node_batch_insert.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/node_batch_insert.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/node_batch_insert_error_handler.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/node_batch_insert_error_handler.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/node_batch_insert_error_handler.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/rel_batch_insert.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/rel_batch_insert.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/rel_batch_insert.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/set.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/set.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/set.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/set_executor.cpp" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/set_executor.cpp.o" "gcc" "src/processor/operator/persistent/CMakeFiles/kuzu_processor_operator_persistent.dir/set_executor.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
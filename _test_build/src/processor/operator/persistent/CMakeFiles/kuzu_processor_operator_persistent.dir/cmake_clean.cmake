@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/batch_insert_error_handler.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/batch_insert_error_handler.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/copy_rdf.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/copy_rdf.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/copy_to.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/copy_to.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/delete.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/delete.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/delete_executor.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/delete_executor.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/index_builder.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/index_builder.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/insert.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/insert.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/insert_executor.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/insert_executor.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/merge.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/merge.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/node_batch_insert.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/node_batch_insert.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/node_batch_insert_error_handler.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/node_batch_insert_error_handler.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/rel_batch_insert.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/rel_batch_insert.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/set.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/set.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/set_executor.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent.dir/set_executor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_persistent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/persistent/reader/copy_from_error.cpp" "src/processor/operator/persistent/reader/CMakeFiles/kuzu_processor_operator_persistent_reader.dir/copy_from_error.cpp.o" "gcc" "src/processor/operator/persistent/reader/CMakeFiles/kuzu_processor_operator_persistent_reader.dir/copy_from_error.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/file_error_handler.cpp" "src/processor/operator/persistent/reader/CMakeFiles/kuzu_processor_operator_persistent_reader.dir/file_error_handler.cpp.o" "gcc" "src/processor/operator/persistent/reader/CMakeFiles/kuzu_processor_operator_persistent_reader.dir/file_error_handler.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/reader_bind_utils.cpp" "src/processor/operator/persistent/reader/CMakeFiles/kuzu_processor_operator_persistent_reader.dir/reader_bind_utils.cpp.o" "gcc" "src/processor/operator/persistent/reader/CMakeFiles/kuzu_processor_operator_persistent_reader.dir/reader_bind_utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_persistent_reader.dir/copy_from_error.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent_reader.dir/copy_from_error.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent_reader.dir/file_error_handler.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent_reader.dir/file_error_handler.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_persistent_reader.dir/reader_bind_utils.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_persistent_reader.dir/reader_bind_utils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_persistent_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
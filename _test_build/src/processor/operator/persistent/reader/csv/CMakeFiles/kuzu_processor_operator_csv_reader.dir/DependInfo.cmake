@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/persistent/reader/csv/base_csv_reader.cpp" "src/processor/operator/persistent/reader/csv/CMakeFiles/kuzu_processor_operator_csv_reader.dir/base_csv_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/csv/CMakeFiles/kuzu_processor_operator_csv_reader.dir/base_csv_reader.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/csv/driver.cpp" "src/processor/operator/persistent/reader/csv/CMakeFiles/kuzu_processor_operator_csv_reader.dir/driver.cpp.o" "gcc" "src/processor/operator/persistent/reader/csv/CMakeFiles/kuzu_processor_operator_csv_reader.dir/driver.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/csv/parallel_csv_reader.cpp" "src/processor/operator/persistent/reader/csv/CMakeFiles/kuzu_processor_operator_csv_reader.dir/parallel_csv_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/csv/CMakeFiles/kuzu_processor_operator_csv_reader.dir/parallel_csv_reader.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/csv/serial_csv_reader.cpp" "src/processor/operator/persistent/reader/csv/CMakeFiles/kuzu_processor_operator_csv_reader.dir/serial_csv_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/csv/CMakeFiles/kuzu_processor_operator_csv_reader.dir/serial_csv_reader.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_csv_reader.dir/base_csv_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_csv_reader.dir/base_csv_reader.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_csv_reader.dir/driver.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_csv_reader.dir/driver.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_csv_reader.dir/parallel_csv_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_csv_reader.dir/parallel_csv_reader.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_csv_reader.dir/serial_csv_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_csv_reader.dir/serial_csv_reader.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_csv_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/persistent/reader/parquet/boolean_column_reader.cpp" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/boolean_column_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/boolean_column_reader.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/parquet/column_reader.cpp" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/column_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/column_reader.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/parquet/interval_column_reader.cpp" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/interval_column_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/interval_column_reader.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/parquet/list_column_reader.cpp" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/list_column_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/list_column_reader.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/parquet/parquet_reader.cpp" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/parquet_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/parquet_reader.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/parquet/parquet_timestamp.cpp" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/parquet_timestamp.cpp.o" "gcc" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/parquet_timestamp.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/parquet/string_column_reader.cpp" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/string_column_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/string_column_reader.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/parquet/struct_column_reader.cpp" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/struct_column_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/struct_column_reader.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/parquet/uuid_column_reader.cpp" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/uuid_column_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/parquet/CMakeFiles/kuzu_processor_operator_parquet_reader.dir/uuid_column_reader.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/boolean_column_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/boolean_column_reader.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/column_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/column_reader.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/interval_column_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/interval_column_reader.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/list_column_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/list_column_reader.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/parquet_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/parquet_reader.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/parquet_timestamp.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/parquet_timestamp.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/string_column_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/string_column_reader.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/struct_column_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/struct_column_reader.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/uuid_column_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_reader.dir/uuid_column_reader.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_parquet_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/persistent/reader/rdf/rdf_reader.cpp" "src/processor/operator/persistent/reader/rdf/CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_reader.cpp.o" "gcc" "src/processor/operator/persistent/reader/rdf/CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_reader.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/rdf/rdf_scan.cpp" "src/processor/operator/persistent/reader/rdf/CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_scan.cpp.o" "gcc" "src/processor/operator/persistent/reader/rdf/CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_scan.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/reader/rdf/rdf_utils.cpp" "src/processor/operator/persistent/reader/rdf/CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_utils.cpp.o" "gcc" "src/processor/operator/persistent/reader/rdf/CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
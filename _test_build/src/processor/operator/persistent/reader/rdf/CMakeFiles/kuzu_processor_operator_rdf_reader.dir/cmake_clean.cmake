@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_reader.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_reader.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_scan.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_scan.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_utils.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_rdf_reader.dir/rdf_utils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_rdf_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/persistent/writer/parquet/basic_column_writer.cpp" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/basic_column_writer.cpp.o" "gcc" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/basic_column_writer.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/writer/parquet/boolean_column_writer.cpp" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/boolean_column_writer.cpp.o" "gcc" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/boolean_column_writer.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/writer/parquet/column_writer.cpp" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/column_writer.cpp.o" "gcc" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/column_writer.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/writer/parquet/interval_column_writer.cpp" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/interval_column_writer.cpp.o" "gcc" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/interval_column_writer.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/writer/parquet/list_column_writer.cpp" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/list_column_writer.cpp.o" "gcc" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/list_column_writer.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/writer/parquet/parquet_rle_bp_encoder.cpp" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/parquet_rle_bp_encoder.cpp.o" "gcc" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/parquet_rle_bp_encoder.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/writer/parquet/parquet_writer.cpp" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/parquet_writer.cpp.o" "gcc" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/parquet_writer.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/writer/parquet/string_column_writer.cpp" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/string_column_writer.cpp.o" "gcc" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/string_column_writer.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/writer/parquet/struct_column_writer.cpp" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/struct_column_writer.cpp.o" "gcc" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/struct_column_writer.cpp.o.d"
+  "/root/repo/src/processor/operator/persistent/writer/parquet/uuid_column_writer.cpp" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/uuid_column_writer.cpp.o" "gcc" "src/processor/operator/persistent/writer/parquet/CMakeFiles/kuzu_processor_operator_parquet_writer.dir/uuid_column_writer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/basic_column_writer.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/basic_column_writer.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/boolean_column_writer.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/boolean_column_writer.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/column_writer.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/column_writer.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/interval_column_writer.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/interval_column_writer.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/list_column_writer.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/list_column_writer.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/parquet_rle_bp_encoder.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/parquet_rle_bp_encoder.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/parquet_writer.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/parquet_writer.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/string_column_writer.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/string_column_writer.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/struct_column_writer.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/struct_column_writer.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/uuid_column_writer.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_parquet_writer.dir/uuid_column_writer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_parquet_writer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/recursive_extend/frontier.cpp" "src/processor/operator/recursive_extend/CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/frontier.cpp.o" "gcc" "src/processor/operator/recursive_extend/CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/frontier.cpp.o.d"
+  "/root/repo/src/processor/operator/recursive_extend/frontier_scanner.cpp" "src/processor/operator/recursive_extend/CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/frontier_scanner.cpp.o" "gcc" "src/processor/operator/recursive_extend/CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/frontier_scanner.cpp.o.d"
+  "/root/repo/src/processor/operator/recursive_extend/path_property_probe.cpp" "src/processor/operator/recursive_extend/CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/path_property_probe.cpp.o" "gcc" "src/processor/operator/recursive_extend/CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/path_property_probe.cpp.o.d"
+  "/root/repo/src/processor/operator/recursive_extend/recursive_join.cpp" "src/processor/operator/recursive_extend/CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/recursive_join.cpp.o" "gcc" "src/processor/operator/recursive_extend/CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/recursive_join.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/frontier.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/frontier.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/frontier_scanner.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/frontier_scanner.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/path_property_probe.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/path_property_probe.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/recursive_join.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/recursive_join.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_ver_length_extend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/scan/offset_scan_node_table.cpp" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/offset_scan_node_table.cpp.o" "gcc" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/offset_scan_node_table.cpp.o.d"
+  "/root/repo/src/processor/operator/scan/primary_key_scan_node_table.cpp" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/primary_key_scan_node_table.cpp.o" "gcc" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/primary_key_scan_node_table.cpp.o.d"
+  "/root/repo/src/processor/operator/scan/scan_multi_rel_tables.cpp" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/scan_multi_rel_tables.cpp.o" "gcc" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/scan_multi_rel_tables.cpp.o.d"
+  "/root/repo/src/processor/operator/scan/scan_node_table.cpp" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/scan_node_table.cpp.o" "gcc" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/scan_node_table.cpp.o.d"
+  "/root/repo/src/processor/operator/scan/scan_rel_table.cpp" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/scan_rel_table.cpp.o" "gcc" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/scan_rel_table.cpp.o.d"
+  "/root/repo/src/processor/operator/scan/scan_table.cpp" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/scan_table.cpp.o" "gcc" "src/processor/operator/scan/CMakeFiles/kuzu_processor_operator_scan.dir/scan_table.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
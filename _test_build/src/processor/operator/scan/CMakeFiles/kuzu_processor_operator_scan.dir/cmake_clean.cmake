@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_scan.dir/offset_scan_node_table.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/offset_scan_node_table.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/primary_key_scan_node_table.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/primary_key_scan_node_table.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/scan_multi_rel_tables.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/scan_multi_rel_tables.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/scan_node_table.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/scan_node_table.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/scan_rel_table.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/scan_rel_table.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/scan_table.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_scan.dir/scan_table.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_scan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
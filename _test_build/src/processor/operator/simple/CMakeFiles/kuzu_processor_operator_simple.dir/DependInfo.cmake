@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/simple/attach_database.cpp" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/attach_database.cpp.o" "gcc" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/attach_database.cpp.o.d"
+  "/root/repo/src/processor/operator/simple/detach_database.cpp" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/detach_database.cpp.o" "gcc" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/detach_database.cpp.o.d"
+  "/root/repo/src/processor/operator/simple/export_db.cpp" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/export_db.cpp.o" "gcc" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/export_db.cpp.o.d"
+  "/root/repo/src/processor/operator/simple/import_db.cpp" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/import_db.cpp.o" "gcc" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/import_db.cpp.o.d"
+  "/root/repo/src/processor/operator/simple/install_extension.cpp" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/install_extension.cpp.o" "gcc" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/install_extension.cpp.o.d"
+  "/root/repo/src/processor/operator/simple/load_extension.cpp" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/load_extension.cpp.o" "gcc" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/load_extension.cpp.o.d"
+  "/root/repo/src/processor/operator/simple/simple.cpp" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/simple.cpp.o" "gcc" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/simple.cpp.o.d"
+  "/root/repo/src/processor/operator/simple/use_database.cpp" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/use_database.cpp.o" "gcc" "src/processor/operator/simple/CMakeFiles/kuzu_processor_operator_simple.dir/use_database.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
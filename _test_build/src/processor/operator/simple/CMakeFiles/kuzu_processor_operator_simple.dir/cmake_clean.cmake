@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_simple.dir/attach_database.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/attach_database.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/detach_database.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/detach_database.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/export_db.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/export_db.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/import_db.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/import_db.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/install_extension.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/install_extension.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/load_extension.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/load_extension.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/simple.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/simple.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/use_database.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_simple.dir/use_database.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
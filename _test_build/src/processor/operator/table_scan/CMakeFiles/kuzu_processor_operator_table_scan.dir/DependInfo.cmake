@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/operator/table_scan/ftable_scan_function.cpp" "src/processor/operator/table_scan/CMakeFiles/kuzu_processor_operator_table_scan.dir/ftable_scan_function.cpp.o" "gcc" "src/processor/operator/table_scan/CMakeFiles/kuzu_processor_operator_table_scan.dir/ftable_scan_function.cpp.o.d"
+  "/root/repo/src/processor/operator/table_scan/union_all_scan.cpp" "src/processor/operator/table_scan/CMakeFiles/kuzu_processor_operator_table_scan.dir/union_all_scan.cpp.o" "gcc" "src/processor/operator/table_scan/CMakeFiles/kuzu_processor_operator_table_scan.dir/union_all_scan.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
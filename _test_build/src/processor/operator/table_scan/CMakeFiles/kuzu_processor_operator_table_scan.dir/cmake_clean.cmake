@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_operator_table_scan.dir/ftable_scan_function.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_table_scan.dir/ftable_scan_function.cpp.o.d"
+  "CMakeFiles/kuzu_processor_operator_table_scan.dir/union_all_scan.cpp.o"
+  "CMakeFiles/kuzu_processor_operator_table_scan.dir/union_all_scan.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_operator_table_scan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/processor/result/base_hash_table.cpp" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/base_hash_table.cpp.o" "gcc" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/base_hash_table.cpp.o.d"
+  "/root/repo/src/processor/result/factorized_table.cpp" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/factorized_table.cpp.o" "gcc" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/factorized_table.cpp.o.d"
+  "/root/repo/src/processor/result/factorized_table_schema.cpp" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/factorized_table_schema.cpp.o" "gcc" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/factorized_table_schema.cpp.o.d"
+  "/root/repo/src/processor/result/factorized_table_util.cpp" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/factorized_table_util.cpp.o" "gcc" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/factorized_table_util.cpp.o.d"
+  "/root/repo/src/processor/result/flat_tuple.cpp" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/flat_tuple.cpp.o" "gcc" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/flat_tuple.cpp.o.d"
+  "/root/repo/src/processor/result/pattern_creation_info_table.cpp" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/pattern_creation_info_table.cpp.o" "gcc" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/pattern_creation_info_table.cpp.o.d"
+  "/root/repo/src/processor/result/result_set.cpp" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/result_set.cpp.o" "gcc" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/result_set.cpp.o.d"
+  "/root/repo/src/processor/result/result_set_descriptor.cpp" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/result_set_descriptor.cpp.o" "gcc" "src/processor/result/CMakeFiles/kuzu_processor_result.dir/result_set_descriptor.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
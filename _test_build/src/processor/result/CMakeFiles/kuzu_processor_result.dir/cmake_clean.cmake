@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_processor_result.dir/base_hash_table.cpp.o"
+  "CMakeFiles/kuzu_processor_result.dir/base_hash_table.cpp.o.d"
+  "CMakeFiles/kuzu_processor_result.dir/factorized_table.cpp.o"
+  "CMakeFiles/kuzu_processor_result.dir/factorized_table.cpp.o.d"
+  "CMakeFiles/kuzu_processor_result.dir/factorized_table_schema.cpp.o"
+  "CMakeFiles/kuzu_processor_result.dir/factorized_table_schema.cpp.o.d"
+  "CMakeFiles/kuzu_processor_result.dir/factorized_table_util.cpp.o"
+  "CMakeFiles/kuzu_processor_result.dir/factorized_table_util.cpp.o.d"
+  "CMakeFiles/kuzu_processor_result.dir/flat_tuple.cpp.o"
+  "CMakeFiles/kuzu_processor_result.dir/flat_tuple.cpp.o.d"
+  "CMakeFiles/kuzu_processor_result.dir/pattern_creation_info_table.cpp.o"
+  "CMakeFiles/kuzu_processor_result.dir/pattern_creation_info_table.cpp.o.d"
+  "CMakeFiles/kuzu_processor_result.dir/result_set.cpp.o"
+  "CMakeFiles/kuzu_processor_result.dir/result_set.cpp.o.d"
+  "CMakeFiles/kuzu_processor_result.dir/result_set_descriptor.cpp.o"
+  "CMakeFiles/kuzu_processor_result.dir/result_set_descriptor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_processor_result.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/storage/db_file_id.cpp" "src/storage/CMakeFiles/kuzu_storage.dir/db_file_id.cpp.o" "gcc" "src/storage/CMakeFiles/kuzu_storage.dir/db_file_id.cpp.o.d"
+  "/root/repo/src/storage/file_handle.cpp" "src/storage/CMakeFiles/kuzu_storage.dir/file_handle.cpp.o" "gcc" "src/storage/CMakeFiles/kuzu_storage.dir/file_handle.cpp.o.d"
+  "/root/repo/src/storage/shadow_utils.cpp" "src/storage/CMakeFiles/kuzu_storage.dir/shadow_utils.cpp.o" "gcc" "src/storage/CMakeFiles/kuzu_storage.dir/shadow_utils.cpp.o.d"
+  "/root/repo/src/storage/storage_manager.cpp" "src/storage/CMakeFiles/kuzu_storage.dir/storage_manager.cpp.o" "gcc" "src/storage/CMakeFiles/kuzu_storage.dir/storage_manager.cpp.o.d"
+  "/root/repo/src/storage/storage_utils.cpp" "src/storage/CMakeFiles/kuzu_storage.dir/storage_utils.cpp.o" "gcc" "src/storage/CMakeFiles/kuzu_storage.dir/storage_utils.cpp.o.d"
+  "/root/repo/src/storage/storage_version_info.cpp" "src/storage/CMakeFiles/kuzu_storage.dir/storage_version_info.cpp.o" "gcc" "src/storage/CMakeFiles/kuzu_storage.dir/storage_version_info.cpp.o.d"
+  "/root/repo/src/storage/undo_buffer.cpp" "src/storage/CMakeFiles/kuzu_storage.dir/undo_buffer.cpp.o" "gcc" "src/storage/CMakeFiles/kuzu_storage.dir/undo_buffer.cpp.o.d"
+  "/root/repo/src/storage/wal_replayer.cpp" "src/storage/CMakeFiles/kuzu_storage.dir/wal_replayer.cpp.o" "gcc" "src/storage/CMakeFiles/kuzu_storage.dir/wal_replayer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_storage.dir/db_file_id.cpp.o"
+  "CMakeFiles/kuzu_storage.dir/db_file_id.cpp.o.d"
+  "CMakeFiles/kuzu_storage.dir/file_handle.cpp.o"
+  "CMakeFiles/kuzu_storage.dir/file_handle.cpp.o.d"
+  "CMakeFiles/kuzu_storage.dir/shadow_utils.cpp.o"
+  "CMakeFiles/kuzu_storage.dir/shadow_utils.cpp.o.d"
+  "CMakeFiles/kuzu_storage.dir/storage_manager.cpp.o"
+  "CMakeFiles/kuzu_storage.dir/storage_manager.cpp.o.d"
+  "CMakeFiles/kuzu_storage.dir/storage_utils.cpp.o"
+  "CMakeFiles/kuzu_storage.dir/storage_utils.cpp.o.d"
+  "CMakeFiles/kuzu_storage.dir/storage_version_info.cpp.o"
+  "CMakeFiles/kuzu_storage.dir/storage_version_info.cpp.o.d"
+  "CMakeFiles/kuzu_storage.dir/undo_buffer.cpp.o"
+  "CMakeFiles/kuzu_storage.dir/undo_buffer.cpp.o.d"
+  "CMakeFiles/kuzu_storage.dir/wal_replayer.cpp.o"
+  "CMakeFiles/kuzu_storage.dir/wal_replayer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/storage/buffer_manager/buffer_manager.cpp" "src/storage/buffer_manager/CMakeFiles/kuzu_storage_buffer_manager.dir/buffer_manager.cpp.o" "gcc" "src/storage/buffer_manager/CMakeFiles/kuzu_storage_buffer_manager.dir/buffer_manager.cpp.o.d"
+  "/root/repo/src/storage/buffer_manager/memory_manager.cpp" "src/storage/buffer_manager/CMakeFiles/kuzu_storage_buffer_manager.dir/memory_manager.cpp.o" "gcc" "src/storage/buffer_manager/CMakeFiles/kuzu_storage_buffer_manager.dir/memory_manager.cpp.o.d"
+  "/root/repo/src/storage/buffer_manager/spiller.cpp" "src/storage/buffer_manager/CMakeFiles/kuzu_storage_buffer_manager.dir/spiller.cpp.o" "gcc" "src/storage/buffer_manager/CMakeFiles/kuzu_storage_buffer_manager.dir/spiller.cpp.o.d"
+  "/root/repo/src/storage/buffer_manager/vm_region.cpp" "src/storage/buffer_manager/CMakeFiles/kuzu_storage_buffer_manager.dir/vm_region.cpp.o" "gcc" "src/storage/buffer_manager/CMakeFiles/kuzu_storage_buffer_manager.dir/vm_region.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_storage_buffer_manager.dir/buffer_manager.cpp.o"
+  "CMakeFiles/kuzu_storage_buffer_manager.dir/buffer_manager.cpp.o.d"
+  "CMakeFiles/kuzu_storage_buffer_manager.dir/memory_manager.cpp.o"
+  "CMakeFiles/kuzu_storage_buffer_manager.dir/memory_manager.cpp.o.d"
+  "CMakeFiles/kuzu_storage_buffer_manager.dir/spiller.cpp.o"
+  "CMakeFiles/kuzu_storage_buffer_manager.dir/spiller.cpp.o.d"
+  "CMakeFiles/kuzu_storage_buffer_manager.dir/vm_region.cpp.o"
+  "CMakeFiles/kuzu_storage_buffer_manager.dir/vm_region.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_storage_buffer_manager.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/storage/compression/bitpacking_int128.cpp" "src/storage/compression/CMakeFiles/kuzu_storage_compression.dir/bitpacking_int128.cpp.o" "gcc" "src/storage/compression/CMakeFiles/kuzu_storage_compression.dir/bitpacking_int128.cpp.o.d"
+  "/root/repo/src/storage/compression/bitpacking_utils.cpp" "src/storage/compression/CMakeFiles/kuzu_storage_compression.dir/bitpacking_utils.cpp.o" "gcc" "src/storage/compression/CMakeFiles/kuzu_storage_compression.dir/bitpacking_utils.cpp.o.d"
+  "/root/repo/src/storage/compression/compression.cpp" "src/storage/compression/CMakeFiles/kuzu_storage_compression.dir/compression.cpp.o" "gcc" "src/storage/compression/CMakeFiles/kuzu_storage_compression.dir/compression.cpp.o.d"
+  "/root/repo/src/storage/compression/float_compression.cpp" "src/storage/compression/CMakeFiles/kuzu_storage_compression.dir/float_compression.cpp.o" "gcc" "src/storage/compression/CMakeFiles/kuzu_storage_compression.dir/float_compression.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_storage_compression.dir/bitpacking_int128.cpp.o"
+  "CMakeFiles/kuzu_storage_compression.dir/bitpacking_int128.cpp.o.d"
+  "CMakeFiles/kuzu_storage_compression.dir/bitpacking_utils.cpp.o"
+  "CMakeFiles/kuzu_storage_compression.dir/bitpacking_utils.cpp.o.d"
+  "CMakeFiles/kuzu_storage_compression.dir/compression.cpp.o"
+  "CMakeFiles/kuzu_storage_compression.dir/compression.cpp.o.d"
+  "CMakeFiles/kuzu_storage_compression.dir/float_compression.cpp.o"
+  "CMakeFiles/kuzu_storage_compression.dir/float_compression.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_storage_compression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/storage/index/hash_index.cpp" "src/storage/index/CMakeFiles/kuzu_storage_index.dir/hash_index.cpp.o" "gcc" "src/storage/index/CMakeFiles/kuzu_storage_index.dir/hash_index.cpp.o.d"
+  "/root/repo/src/storage/index/in_mem_hash_index.cpp" "src/storage/index/CMakeFiles/kuzu_storage_index.dir/in_mem_hash_index.cpp.o" "gcc" "src/storage/index/CMakeFiles/kuzu_storage_index.dir/in_mem_hash_index.cpp.o.d"
+  "/root/repo/src/storage/index/range_index.cpp" "src/storage/index/CMakeFiles/kuzu_storage_index.dir/range_index.cpp.o" "gcc" "src/storage/index/CMakeFiles/kuzu_storage_index.dir/range_index.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_storage_index.dir/hash_index.cpp.o"
+  "CMakeFiles/kuzu_storage_index.dir/hash_index.cpp.o.d"
+  "CMakeFiles/kuzu_storage_index.dir/in_mem_hash_index.cpp.o"
+  "CMakeFiles/kuzu_storage_index.dir/in_mem_hash_index.cpp.o.d"
+  "CMakeFiles/kuzu_storage_index.dir/range_index.cpp.o"
+  "CMakeFiles/kuzu_storage_index.dir/range_index.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_storage_index.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/storage/local_storage/local_node_table.cpp" "src/storage/local_storage/CMakeFiles/kuzu_storage_local_storage.dir/local_node_table.cpp.o" "gcc" "src/storage/local_storage/CMakeFiles/kuzu_storage_local_storage.dir/local_node_table.cpp.o.d"
+  "/root/repo/src/storage/local_storage/local_rel_table.cpp" "src/storage/local_storage/CMakeFiles/kuzu_storage_local_storage.dir/local_rel_table.cpp.o" "gcc" "src/storage/local_storage/CMakeFiles/kuzu_storage_local_storage.dir/local_rel_table.cpp.o.d"
+  "/root/repo/src/storage/local_storage/local_storage.cpp" "src/storage/local_storage/CMakeFiles/kuzu_storage_local_storage.dir/local_storage.cpp.o" "gcc" "src/storage/local_storage/CMakeFiles/kuzu_storage_local_storage.dir/local_storage.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
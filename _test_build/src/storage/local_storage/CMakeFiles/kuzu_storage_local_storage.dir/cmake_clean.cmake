@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_storage_local_storage.dir/local_node_table.cpp.o"
+  "CMakeFiles/kuzu_storage_local_storage.dir/local_node_table.cpp.o.d"
+  "CMakeFiles/kuzu_storage_local_storage.dir/local_rel_table.cpp.o"
+  "CMakeFiles/kuzu_storage_local_storage.dir/local_rel_table.cpp.o.d"
+  "CMakeFiles/kuzu_storage_local_storage.dir/local_storage.cpp.o"
+  "CMakeFiles/kuzu_storage_local_storage.dir/local_storage.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_storage_local_storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_storage_predicate.dir/column_predicate.cpp.o"
+  "CMakeFiles/kuzu_storage_predicate.dir/column_predicate.cpp.o.d"
+  "CMakeFiles/kuzu_storage_predicate.dir/constant_predicate.cpp.o"
+  "CMakeFiles/kuzu_storage_predicate.dir/constant_predicate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_storage_predicate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
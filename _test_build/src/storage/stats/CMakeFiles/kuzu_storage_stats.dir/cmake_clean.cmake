@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_storage_stats.dir/table_statistics_collector.cpp.o"
+  "CMakeFiles/kuzu_storage_stats.dir/table_statistics_collector.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_storage_stats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
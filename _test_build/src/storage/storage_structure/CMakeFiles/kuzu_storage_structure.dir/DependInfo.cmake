@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/storage/storage_structure/disk_array.cpp" "src/storage/storage_structure/CMakeFiles/kuzu_storage_structure.dir/disk_array.cpp.o" "gcc" "src/storage/storage_structure/CMakeFiles/kuzu_storage_structure.dir/disk_array.cpp.o.d"
+  "/root/repo/src/storage/storage_structure/disk_array_collection.cpp" "src/storage/storage_structure/CMakeFiles/kuzu_storage_structure.dir/disk_array_collection.cpp.o" "gcc" "src/storage/storage_structure/CMakeFiles/kuzu_storage_structure.dir/disk_array_collection.cpp.o.d"
+  "/root/repo/src/storage/storage_structure/in_mem_page.cpp" "src/storage/storage_structure/CMakeFiles/kuzu_storage_structure.dir/in_mem_page.cpp.o" "gcc" "src/storage/storage_structure/CMakeFiles/kuzu_storage_structure.dir/in_mem_page.cpp.o.d"
+  "/root/repo/src/storage/storage_structure/overflow_file.cpp" "src/storage/storage_structure/CMakeFiles/kuzu_storage_structure.dir/overflow_file.cpp.o" "gcc" "src/storage/storage_structure/CMakeFiles/kuzu_storage_structure.dir/overflow_file.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_storage_structure.dir/disk_array.cpp.o"
+  "CMakeFiles/kuzu_storage_structure.dir/disk_array.cpp.o.d"
+  "CMakeFiles/kuzu_storage_structure.dir/disk_array_collection.cpp.o"
+  "CMakeFiles/kuzu_storage_structure.dir/disk_array_collection.cpp.o.d"
+  "CMakeFiles/kuzu_storage_structure.dir/in_mem_page.cpp.o"
+  "CMakeFiles/kuzu_storage_structure.dir/in_mem_page.cpp.o.d"
+  "CMakeFiles/kuzu_storage_structure.dir/overflow_file.cpp.o"
+  "CMakeFiles/kuzu_storage_structure.dir/overflow_file.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_storage_structure.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
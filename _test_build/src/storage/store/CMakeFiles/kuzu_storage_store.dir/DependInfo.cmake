@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/storage/store/chunked_node_group.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/chunked_node_group.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/chunked_node_group.cpp.o.d"
+  "/root/repo/src/storage/store/column.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/column.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/column.cpp.o.d"
+  "/root/repo/src/storage/store/column_chunk.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/column_chunk.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/column_chunk.cpp.o.d"
+  "/root/repo/src/storage/store/column_chunk_data.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/column_chunk_data.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/column_chunk_data.cpp.o.d"
+  "/root/repo/src/storage/store/column_chunk_metadata.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/column_chunk_metadata.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/column_chunk_metadata.cpp.o.d"
+  "/root/repo/src/storage/store/column_reader_writer.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/column_reader_writer.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/column_reader_writer.cpp.o.d"
+  "/root/repo/src/storage/store/compression_flush_buffer.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/compression_flush_buffer.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/compression_flush_buffer.cpp.o.d"
+  "/root/repo/src/storage/store/csr_chunked_node_group.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/csr_chunked_node_group.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/csr_chunked_node_group.cpp.o.d"
+  "/root/repo/src/storage/store/csr_node_group.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/csr_node_group.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/csr_node_group.cpp.o.d"
+  "/root/repo/src/storage/store/dictionary_chunk.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/dictionary_chunk.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/dictionary_chunk.cpp.o.d"
+  "/root/repo/src/storage/store/dictionary_column.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/dictionary_column.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/dictionary_column.cpp.o.d"
+  "/root/repo/src/storage/store/in_mem_chunked_node_group_collection.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/in_mem_chunked_node_group_collection.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/in_mem_chunked_node_group_collection.cpp.o.d"
+  "/root/repo/src/storage/store/in_memory_exception_chunk.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/in_memory_exception_chunk.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/in_memory_exception_chunk.cpp.o.d"
+  "/root/repo/src/storage/store/list_chunk_data.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/list_chunk_data.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/list_chunk_data.cpp.o.d"
+  "/root/repo/src/storage/store/list_column.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/list_column.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/list_column.cpp.o.d"
+  "/root/repo/src/storage/store/node_group.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/node_group.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/node_group.cpp.o.d"
+  "/root/repo/src/storage/store/node_group_collection.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/node_group_collection.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/node_group_collection.cpp.o.d"
+  "/root/repo/src/storage/store/node_table.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/node_table.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/node_table.cpp.o.d"
+  "/root/repo/src/storage/store/null_column.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/null_column.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/null_column.cpp.o.d"
+  "/root/repo/src/storage/store/rel_table.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/rel_table.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/rel_table.cpp.o.d"
+  "/root/repo/src/storage/store/rel_table_data.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/rel_table_data.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/rel_table_data.cpp.o.d"
+  "/root/repo/src/storage/store/string_chunk_data.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/string_chunk_data.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/string_chunk_data.cpp.o.d"
+  "/root/repo/src/storage/store/string_column.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/string_column.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/string_column.cpp.o.d"
+  "/root/repo/src/storage/store/struct_chunk_data.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/struct_chunk_data.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/struct_chunk_data.cpp.o.d"
+  "/root/repo/src/storage/store/struct_column.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/struct_column.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/struct_column.cpp.o.d"
+  "/root/repo/src/storage/store/table.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/table.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/table.cpp.o.d"
+  "/root/repo/src/storage/store/update_info.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/update_info.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/update_info.cpp.o.d"
+  "/root/repo/src/storage/store/version_info.cpp" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/version_info.cpp.o" "gcc" "src/storage/store/CMakeFiles/kuzu_storage_store.dir/version_info.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
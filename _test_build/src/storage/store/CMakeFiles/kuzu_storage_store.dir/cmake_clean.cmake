@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_storage_store.dir/chunked_node_group.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/chunked_node_group.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/column.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/column.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/column_chunk.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/column_chunk.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/column_chunk_data.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/column_chunk_data.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/column_chunk_metadata.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/column_chunk_metadata.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/column_reader_writer.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/column_reader_writer.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/compression_flush_buffer.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/compression_flush_buffer.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/csr_chunked_node_group.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/csr_chunked_node_group.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/csr_node_group.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/csr_node_group.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/dictionary_chunk.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/dictionary_chunk.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/dictionary_column.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/dictionary_column.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/in_mem_chunked_node_group_collection.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/in_mem_chunked_node_group_collection.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/in_memory_exception_chunk.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/in_memory_exception_chunk.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/list_chunk_data.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/list_chunk_data.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/list_column.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/list_column.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/node_group.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/node_group.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/node_group_collection.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/node_group_collection.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/node_table.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/node_table.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/null_column.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/null_column.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/rel_table.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/rel_table.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/rel_table_data.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/rel_table_data.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/string_chunk_data.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/string_chunk_data.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/string_column.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/string_column.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/struct_chunk_data.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/struct_chunk_data.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/struct_column.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/struct_column.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/table.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/table.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/update_info.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/update_info.cpp.o.d"
+  "CMakeFiles/kuzu_storage_store.dir/version_info.cpp.o"
+  "CMakeFiles/kuzu_storage_store.dir/version_info.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_storage_store.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
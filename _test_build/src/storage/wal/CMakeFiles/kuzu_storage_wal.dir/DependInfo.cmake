@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/storage/wal/local_wal.cpp" "src/storage/wal/CMakeFiles/kuzu_storage_wal.dir/local_wal.cpp.o" "gcc" "src/storage/wal/CMakeFiles/kuzu_storage_wal.dir/local_wal.cpp.o.d"
+  "/root/repo/src/storage/wal/shadow_file.cpp" "src/storage/wal/CMakeFiles/kuzu_storage_wal.dir/shadow_file.cpp.o" "gcc" "src/storage/wal/CMakeFiles/kuzu_storage_wal.dir/shadow_file.cpp.o.d"
+  "/root/repo/src/storage/wal/wal.cpp" "src/storage/wal/CMakeFiles/kuzu_storage_wal.dir/wal.cpp.o" "gcc" "src/storage/wal/CMakeFiles/kuzu_storage_wal.dir/wal.cpp.o.d"
+  "/root/repo/src/storage/wal/wal_record.cpp" "src/storage/wal/CMakeFiles/kuzu_storage_wal.dir/wal_record.cpp.o" "gcc" "src/storage/wal/CMakeFiles/kuzu_storage_wal.dir/wal_record.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_storage_wal.dir/local_wal.cpp.o"
+  "CMakeFiles/kuzu_storage_wal.dir/local_wal.cpp.o.d"
+  "CMakeFiles/kuzu_storage_wal.dir/shadow_file.cpp.o"
+  "CMakeFiles/kuzu_storage_wal.dir/shadow_file.cpp.o.d"
+  "CMakeFiles/kuzu_storage_wal.dir/wal.cpp.o"
+  "CMakeFiles/kuzu_storage_wal.dir/wal.cpp.o.d"
+  "CMakeFiles/kuzu_storage_wal.dir/wal_record.cpp.o"
+  "CMakeFiles/kuzu_storage_wal.dir/wal_record.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_storage_wal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/transaction/transaction.cpp" "src/transaction/CMakeFiles/kuzu_transaction.dir/transaction.cpp.o" "gcc" "src/transaction/CMakeFiles/kuzu_transaction.dir/transaction.cpp.o.d"
+  "/root/repo/src/transaction/transaction_context.cpp" "src/transaction/CMakeFiles/kuzu_transaction.dir/transaction_context.cpp.o" "gcc" "src/transaction/CMakeFiles/kuzu_transaction.dir/transaction_context.cpp.o.d"
+  "/root/repo/src/transaction/transaction_manager.cpp" "src/transaction/CMakeFiles/kuzu_transaction.dir/transaction_manager.cpp.o" "gcc" "src/transaction/CMakeFiles/kuzu_transaction.dir/transaction_manager.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kuzu_transaction.dir/transaction.cpp.o"
+  "CMakeFiles/kuzu_transaction.dir/transaction.cpp.o.d"
+  "CMakeFiles/kuzu_transaction.dir/transaction_context.cpp.o"
+  "CMakeFiles/kuzu_transaction.dir/transaction_context.cpp.o.d"
+  "CMakeFiles/kuzu_transaction.dir/transaction_manager.cpp.o"
+  "CMakeFiles/kuzu_transaction.dir/transaction_manager.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kuzu_transaction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
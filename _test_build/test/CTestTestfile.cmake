@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_test_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("gtest")
+subdirs("test_helper")
+subdirs("test_runner")
+subdirs("graph_test")
+subdirs("c_api")
+subdirs("common")
+subdirs("main")
+subdirs("optimizer")
+subdirs("runner")
+subdirs("storage")
+subdirs("transaction")
+subdirs("util_tests")
+subdirs("copy")
+subdirs("function/gds")
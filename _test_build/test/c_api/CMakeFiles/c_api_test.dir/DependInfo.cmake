@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/c_api/connection_test.cpp" "test/c_api/CMakeFiles/c_api_test.dir/connection_test.cpp.o" "gcc" "test/c_api/CMakeFiles/c_api_test.dir/connection_test.cpp.o.d"
+  "/root/repo/test/c_api/data_type_test.cpp" "test/c_api/CMakeFiles/c_api_test.dir/data_type_test.cpp.o" "gcc" "test/c_api/CMakeFiles/c_api_test.dir/data_type_test.cpp.o.d"
+  "/root/repo/test/c_api/database_test.cpp" "test/c_api/CMakeFiles/c_api_test.dir/database_test.cpp.o" "gcc" "test/c_api/CMakeFiles/c_api_test.dir/database_test.cpp.o.d"
+  "/root/repo/test/c_api/flat_tuple_test.cpp" "test/c_api/CMakeFiles/c_api_test.dir/flat_tuple_test.cpp.o" "gcc" "test/c_api/CMakeFiles/c_api_test.dir/flat_tuple_test.cpp.o.d"
+  "/root/repo/test/c_api/prepared_statement_test.cpp" "test/c_api/CMakeFiles/c_api_test.dir/prepared_statement_test.cpp.o" "gcc" "test/c_api/CMakeFiles/c_api_test.dir/prepared_statement_test.cpp.o.d"
+  "/root/repo/test/c_api/query_result_test.cpp" "test/c_api/CMakeFiles/c_api_test.dir/query_result_test.cpp.o" "gcc" "test/c_api/CMakeFiles/c_api_test.dir/query_result_test.cpp.o.d"
+  "/root/repo/test/c_api/rdf_variant_test.cpp" "test/c_api/CMakeFiles/c_api_test.dir/rdf_variant_test.cpp.o" "gcc" "test/c_api/CMakeFiles/c_api_test.dir/rdf_variant_test.cpp.o.d"
+  "/root/repo/test/c_api/value_test.cpp" "test/c_api/CMakeFiles/c_api_test.dir/value_test.cpp.o" "gcc" "test/c_api/CMakeFiles/c_api_test.dir/value_test.cpp.o.d"
+  "/root/repo/test/c_api/version_test.cpp" "test/c_api/CMakeFiles/c_api_test.dir/version_test.cpp.o" "gcc" "test/c_api/CMakeFiles/c_api_test.dir/version_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/CMakeFiles/kuzu_shared.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/antlr4_cypher/CMakeFiles/antlr4_cypher.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/brotli/CMakeFiles/brotlidec.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/brotli/CMakeFiles/brotlicommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/utf8proc/CMakeFiles/utf8proc.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/re2/CMakeFiles/re2.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/serd/CMakeFiles/serd.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/fastpfor/CMakeFiles/fastpfor.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/miniparquet/CMakeFiles/miniparquet.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/zstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/miniz/CMakeFiles/miniz.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/mbedtls/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/lz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
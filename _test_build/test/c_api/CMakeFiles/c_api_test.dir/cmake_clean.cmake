@@ -0,0 +1,28 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/c_api_test.dir/connection_test.cpp.o"
+  "CMakeFiles/c_api_test.dir/connection_test.cpp.o.d"
+  "CMakeFiles/c_api_test.dir/data_type_test.cpp.o"
+  "CMakeFiles/c_api_test.dir/data_type_test.cpp.o.d"
+  "CMakeFiles/c_api_test.dir/database_test.cpp.o"
+  "CMakeFiles/c_api_test.dir/database_test.cpp.o.d"
+  "CMakeFiles/c_api_test.dir/flat_tuple_test.cpp.o"
+  "CMakeFiles/c_api_test.dir/flat_tuple_test.cpp.o.d"
+  "CMakeFiles/c_api_test.dir/prepared_statement_test.cpp.o"
+  "CMakeFiles/c_api_test.dir/prepared_statement_test.cpp.o.d"
+  "CMakeFiles/c_api_test.dir/query_result_test.cpp.o"
+  "CMakeFiles/c_api_test.dir/query_result_test.cpp.o.d"
+  "CMakeFiles/c_api_test.dir/rdf_variant_test.cpp.o"
+  "CMakeFiles/c_api_test.dir/rdf_variant_test.cpp.o.d"
+  "CMakeFiles/c_api_test.dir/value_test.cpp.o"
+  "CMakeFiles/c_api_test.dir/value_test.cpp.o.d"
+  "CMakeFiles/c_api_test.dir/version_test.cpp.o"
+  "CMakeFiles/c_api_test.dir/version_test.cpp.o.d"
+  "c_api_test"
+  "c_api_test.pdb"
+  "c_api_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/c_api_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
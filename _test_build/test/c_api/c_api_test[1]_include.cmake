@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_test_build/test/c_api/c_api_test[1]_tests.cmake")
+  include("/root/repo/_test_build/test/c_api/c_api_test[1]_tests.cmake")
+else()
+  add_test(c_api_test_NOT_BUILT c_api_test_NOT_BUILT)
+endif()
@@ -0,0 +1,245 @@
+add_test([=[CApiConnectionTest.CreationAndDestroy]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiConnectionTest.CreationAndDestroy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiConnectionTest.CreationAndDestroy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiConnectionTest.CreationAndDestroyWithNullDatabase]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiConnectionTest.CreationAndDestroyWithNullDatabase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiConnectionTest.CreationAndDestroyWithNullDatabase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiConnectionTest.Query]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiConnectionTest.Query]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiConnectionTest.Query]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiConnectionTest.SetGetMaxNumThreadForExec]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiConnectionTest.SetGetMaxNumThreadForExec]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiConnectionTest.SetGetMaxNumThreadForExec]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiConnectionTest.Prepare]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiConnectionTest.Prepare]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiConnectionTest.Prepare]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiConnectionTest.Execute]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiConnectionTest.Execute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiConnectionTest.Execute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiConnectionTest.ExecuteError]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiConnectionTest.ExecuteError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiConnectionTest.ExecuteError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiConnectionTest.ExecuteBatch]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiConnectionTest.ExecuteBatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiConnectionTest.ExecuteBatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiConnectionTest.QueryTimeout]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiConnectionTest.QueryTimeout]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiConnectionTest.QueryTimeout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiConnectionTest.Interrupt]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiConnectionTest.Interrupt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiConnectionTest.Interrupt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiDataTypeTest.Create]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiDataTypeTest.Create]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiDataTypeTest.Create]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiDataTypeTest.Clone]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiDataTypeTest.Clone]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiDataTypeTest.Clone]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiDataTypeTest.Equals]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiDataTypeTest.Equals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiDataTypeTest.Equals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiDataTypeTest.GetID]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiDataTypeTest.GetID]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiDataTypeTest.GetID]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiDataTypeTest.GetFixedNumElementsInList]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiDataTypeTest.GetFixedNumElementsInList]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiDataTypeTest.GetFixedNumElementsInList]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiDatabaseTest.CreationAndDestroy]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiDatabaseTest.CreationAndDestroy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiDatabaseTest.CreationAndDestroy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiDatabaseTest.CreationReadOnly]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiDatabaseTest.CreationReadOnly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiDatabaseTest.CreationReadOnly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiDatabaseTest.CreationInMemory]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiDatabaseTest.CreationInMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiDatabaseTest.CreationInMemory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiDatabaseTest.CreationHomeDir]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiDatabaseTest.CreationHomeDir]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiDatabaseTest.CreationHomeDir]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiFlatTupleTest.GetValue]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiFlatTupleTest.GetValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiFlatTupleTest.GetValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiFlatTupleTest.ToString]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiFlatTupleTest.ToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiFlatTupleTest.ToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.IsSuccess]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.IsSuccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.IsSuccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.GetErrorMessage]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.GetErrorMessage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.GetErrorMessage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindBool]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindBool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindBool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindInt64]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindInt64]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindInt64]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindInt32]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindInt32]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindInt32]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindInt16]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindInt16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindInt16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindInt8]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindInt8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindInt8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindUInt64]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindUInt64]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindUInt64]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindUInt32]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindUInt32]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindUInt32]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindUInt16]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindUInt16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindUInt16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindUInt8]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindUInt8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindUInt8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindDouble]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindDouble]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindDouble]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindFloat]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindFloat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindFloat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindString]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindDate]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindDate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindDate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindTimestamp]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindTimestamp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindTimestamp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindInteval]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindInteval]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindInteval]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiPreparedStatementTest.BindValue]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiPreparedStatementTest.BindValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiPreparedStatementTest.BindValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiQueryResultTest.GetErrorMessage]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiQueryResultTest.GetErrorMessage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiQueryResultTest.GetErrorMessage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiQueryResultTest.ToString]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiQueryResultTest.ToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiQueryResultTest.ToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiQueryResultTest.GetNumColumns]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiQueryResultTest.GetNumColumns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiQueryResultTest.GetNumColumns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiQueryResultTest.GetColumnName]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiQueryResultTest.GetColumnName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiQueryResultTest.GetColumnName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiQueryResultTest.GetColumnDataType]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiQueryResultTest.GetColumnDataType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiQueryResultTest.GetColumnDataType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiQueryResultTest.GetQuerySummary]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiQueryResultTest.GetQuerySummary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiQueryResultTest.GetQuerySummary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiQueryResultTest.GetNext]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiQueryResultTest.GetNext]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiQueryResultTest.GetNext]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiQueryResultTest.ResetIterator]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiQueryResultTest.ResetIterator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiQueryResultTest.ResetIterator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiQueryResultTest.MultipleQuery]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiQueryResultTest.MultipleQuery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiQueryResultTest.MultipleQuery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiRdfVariantTest.GetValue]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiRdfVariantTest.GetValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiRdfVariantTest.GetValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateNull]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateNull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateNull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateNullWithDatatype]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateNullWithDatatype]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateNullWithDatatype]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.IsNull]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.IsNull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.IsNull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.SetNull]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.SetNull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.SetNull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateDefault]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateDefault]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateDefault]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateBool]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateBool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateBool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateInt8]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateInt8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateInt8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateInt16]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateInt16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateInt16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateInt32]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateInt32]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateInt32]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateInt64]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateInt64]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateInt64]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateUInt8]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateUInt8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateUInt8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateUInt16]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateUInt16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateUInt16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateUInt32]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateUInt32]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateUInt32]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateUInt64]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateUInt64]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateUInt64]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateINT128]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateINT128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateINT128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateFloat]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateFloat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateFloat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateDouble]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateDouble]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateDouble]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateInternalID]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateInternalID]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateInternalID]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateDate]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateDate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateDate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateTimeStamp]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateTimeStamp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateTimeStamp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateTimeStampNonStandard]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateTimeStampNonStandard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateTimeStampNonStandard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateInterval]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateInterval]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateInterval]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.CreateString]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.CreateString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.CreateString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.Clone]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.Clone]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.Clone]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTestEmptyDB.Copy]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTestEmptyDB.Copy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTestEmptyDB.Copy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetListSize]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetListSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetListSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetListElement]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetListElement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetListElement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetStructNumFields]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetStructNumFields]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetStructNumFields]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetStructFieldName]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetStructFieldName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetStructFieldName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetStructFieldValue]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetStructFieldValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetStructFieldValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetDataType]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetDataType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetDataType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetBool]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetBool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetBool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetInt8]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetInt8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetInt8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetInt16]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetInt16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetInt16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetInt32]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetInt32]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetInt32]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetInt64]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetInt64]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetInt64]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetUInt8]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetUInt8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetUInt8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetUInt16]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetUInt16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetUInt16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetUInt32]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetUInt32]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetUInt32]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetUInt64]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetUInt64]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetUInt64]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetInt128]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetInt128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetInt128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.StringToInt128Test]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.StringToInt128Test]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.StringToInt128Test]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.Int128ToStringTest]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.Int128ToStringTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.Int128ToStringTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetFloat]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetFloat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetFloat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetDouble]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetDouble]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetDouble]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetInternalID]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetInternalID]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetInternalID]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetRelVal]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetRelVal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetRelVal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetDate]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetDate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetDate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetTimestamp]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetTimestamp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetTimestamp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetInterval]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetInterval]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetInterval]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetString]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetBlob]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetBlob]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetBlob]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetUUID]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetUUID]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetUUID]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.ToSting]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.ToSting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.ToSting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.NodeValGetLabelVal]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.NodeValGetLabelVal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.NodeValGetLabelVal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.NodeValGetID]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.NodeValGetID]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.NodeValGetID]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.NodeValGetLabelName]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.NodeValGetLabelName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.NodeValGetLabelName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.NodeValGetProperty]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.NodeValGetProperty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.NodeValGetProperty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.NodeValToString]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.NodeValToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.NodeValToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.RelValGetProperty]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.RelValGetProperty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.RelValGetProperty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.RelValToString]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.RelValToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.RelValToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetTmFromNonStandardTimestamp]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetTmFromNonStandardTimestamp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetTmFromNonStandardTimestamp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetTmFromTimestamp]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetTmFromTimestamp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetTmFromTimestamp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetTmFromDate]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetTmFromDate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetTmFromDate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetTimestampFromTm]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetTimestampFromTm]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetTimestampFromTm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetNonStandardTimestampFromTm]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetNonStandardTimestampFromTm]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetNonStandardTimestampFromTm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetDateFromTm]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetDateFromTm]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetDateFromTm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetDateFromString]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetDateFromString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetDateFromString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetStringFromDate]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetStringFromDate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetStringFromDate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetDifftimeFromInterval]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetDifftimeFromInterval]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetDifftimeFromInterval]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiValueTest.GetIntervalFromDifftime]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiValueTest.GetIntervalFromDifftime]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiValueTest.GetIntervalFromDifftime]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiVersionTest.GetVersion]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiVersionTest.GetVersion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiVersionTest.GetVersion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CApiVersionTest.GetStorageVersion]=]  /root/repo/_test_build/test/c_api/c_api_test [==[--gtest_filter=CApiVersionTest.GetStorageVersion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CApiVersionTest.GetStorageVersion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/c_api SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  c_api_test_TESTS CApiConnectionTest.CreationAndDestroy CApiConnectionTest.CreationAndDestroyWithNullDatabase CApiConnectionTest.Query CApiConnectionTest.SetGetMaxNumThreadForExec CApiConnectionTest.Prepare CApiConnectionTest.Execute CApiConnectionTest.ExecuteError CApiConnectionTest.ExecuteBatch CApiConnectionTest.QueryTimeout CApiConnectionTest.Interrupt CApiDataTypeTest.Create CApiDataTypeTest.Clone CApiDataTypeTest.Equals CApiDataTypeTest.GetID CApiDataTypeTest.GetFixedNumElementsInList CApiDatabaseTest.CreationAndDestroy CApiDatabaseTest.CreationReadOnly CApiDatabaseTest.CreationInMemory CApiDatabaseTest.CreationHomeDir CApiFlatTupleTest.GetValue CApiFlatTupleTest.ToString CApiPreparedStatementTest.IsSuccess CApiPreparedStatementTest.GetErrorMessage CApiPreparedStatementTest.BindBool CApiPreparedStatementTest.BindInt64 CApiPreparedStatementTest.BindInt32 CApiPreparedStatementTest.BindInt16 CApiPreparedStatementTest.BindInt8 CApiPreparedStatementTest.BindUInt64 CApiPreparedStatementTest.BindUInt32 CApiPreparedStatementTest.BindUInt16 CApiPreparedStatementTest.BindUInt8 CApiPreparedStatementTest.BindDouble CApiPreparedStatementTest.BindFloat CApiPreparedStatementTest.BindString CApiPreparedStatementTest.BindDate CApiPreparedStatementTest.BindTimestamp CApiPreparedStatementTest.BindInteval CApiPreparedStatementTest.BindValue CApiQueryResultTest.GetErrorMessage CApiQueryResultTest.ToString CApiQueryResultTest.GetNumColumns CApiQueryResultTest.GetColumnName CApiQueryResultTest.GetColumnDataType CApiQueryResultTest.GetQuerySummary CApiQueryResultTest.GetNext CApiQueryResultTest.ResetIterator CApiQueryResultTest.MultipleQuery CApiRdfVariantTest.GetValue CApiValueTestEmptyDB.CreateNull CApiValueTestEmptyDB.CreateNullWithDatatype CApiValueTestEmptyDB.IsNull CApiValueTestEmptyDB.SetNull CApiValueTestEmptyDB.CreateDefault CApiValueTestEmptyDB.CreateBool CApiValueTestEmptyDB.CreateInt8 CApiValueTestEmptyDB.CreateInt16 CApiValueTestEmptyDB.CreateInt32 CApiValueTestEmptyDB.CreateInt64 CApiValueTestEmptyDB.CreateUInt8 CApiValueTestEmptyDB.CreateUInt16 CApiValueTestEmptyDB.CreateUInt32 CApiValueTestEmptyDB.CreateUInt64 CApiValueTestEmptyDB.CreateINT128 CApiValueTestEmptyDB.CreateFloat CApiValueTestEmptyDB.CreateDouble CApiValueTestEmptyDB.CreateInternalID CApiValueTestEmptyDB.CreateDate CApiValueTestEmptyDB.CreateTimeStamp CApiValueTestEmptyDB.CreateTimeStampNonStandard CApiValueTestEmptyDB.CreateInterval CApiValueTestEmptyDB.CreateString CApiValueTestEmptyDB.Clone CApiValueTestEmptyDB.Copy CApiValueTest.GetListSize CApiValueTest.GetListElement CApiValueTest.GetStructNumFields CApiValueTest.GetStructFieldName CApiValueTest.GetStructFieldValue CApiValueTest.GetDataType CApiValueTest.GetBool CApiValueTest.GetInt8 CApiValueTest.GetInt16 CApiValueTest.GetInt32 CApiValueTest.GetInt64 CApiValueTest.GetUInt8 CApiValueTest.GetUInt16 CApiValueTest.GetUInt32 CApiValueTest.GetUInt64 CApiValueTest.GetInt128 CApiValueTest.StringToInt128Test CApiValueTest.Int128ToStringTest CApiValueTest.GetFloat CApiValueTest.GetDouble CApiValueTest.GetInternalID CApiValueTest.GetRelVal CApiValueTest.GetDate CApiValueTest.GetTimestamp CApiValueTest.GetInterval CApiValueTest.GetString CApiValueTest.GetBlob CApiValueTest.GetUUID CApiValueTest.ToSting CApiValueTest.NodeValGetLabelVal CApiValueTest.NodeValGetID CApiValueTest.NodeValGetLabelName CApiValueTest.NodeValGetProperty CApiValueTest.NodeValToString CApiValueTest.RelValGetProperty CApiValueTest.RelValToString CApiValueTest.GetTmFromNonStandardTimestamp CApiValueTest.GetTmFromTimestamp CApiValueTest.GetTmFromDate CApiValueTest.GetTimestampFromTm CApiValueTest.GetNonStandardTimestampFromTm CApiValueTest.GetDateFromTm CApiValueTest.GetDateFromString CApiValueTest.GetStringFromDate CApiValueTest.GetDifftimeFromInterval CApiValueTest.GetIntervalFromDifftime CApiVersionTest.GetVersion CApiVersionTest.GetStorageVersion)
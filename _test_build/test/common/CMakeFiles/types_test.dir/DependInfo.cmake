@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/common/date_test.cpp" "test/common/CMakeFiles/types_test.dir/date_test.cpp.o" "gcc" "test/common/CMakeFiles/types_test.dir/date_test.cpp.o.d"
+  "/root/repo/test/common/int128_test.cpp" "test/common/CMakeFiles/types_test.dir/int128_test.cpp.o" "gcc" "test/common/CMakeFiles/types_test.dir/int128_test.cpp.o.d"
+  "/root/repo/test/common/interval_test.cpp" "test/common/CMakeFiles/types_test.dir/interval_test.cpp.o" "gcc" "test/common/CMakeFiles/types_test.dir/interval_test.cpp.o.d"
+  "/root/repo/test/common/null_mask_test.cpp" "test/common/CMakeFiles/types_test.dir/null_mask_test.cpp.o" "gcc" "test/common/CMakeFiles/types_test.dir/null_mask_test.cpp.o.d"
+  "/root/repo/test/common/string_test.cpp" "test/common/CMakeFiles/types_test.dir/string_test.cpp.o" "gcc" "test/common/CMakeFiles/types_test.dir/string_test.cpp.o.d"
+  "/root/repo/test/common/time_test.cpp" "test/common/CMakeFiles/types_test.dir/time_test.cpp.o" "gcc" "test/common/CMakeFiles/types_test.dir/time_test.cpp.o.d"
+  "/root/repo/test/common/timestamp_test.cpp" "test/common/CMakeFiles/types_test.dir/timestamp_test.cpp.o" "gcc" "test/common/CMakeFiles/types_test.dir/timestamp_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/CMakeFiles/kuzu.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/antlr4_cypher/CMakeFiles/antlr4_cypher.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/brotli/CMakeFiles/brotlidec.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/brotli/CMakeFiles/brotlicommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/utf8proc/CMakeFiles/utf8proc.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/re2/CMakeFiles/re2.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/serd/CMakeFiles/serd.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/fastpfor/CMakeFiles/fastpfor.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/miniparquet/CMakeFiles/miniparquet.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/zstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/miniz/CMakeFiles/miniz.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/mbedtls/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/lz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
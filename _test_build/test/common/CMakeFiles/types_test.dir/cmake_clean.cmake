@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types_test.dir/date_test.cpp.o"
+  "CMakeFiles/types_test.dir/date_test.cpp.o.d"
+  "CMakeFiles/types_test.dir/int128_test.cpp.o"
+  "CMakeFiles/types_test.dir/int128_test.cpp.o.d"
+  "CMakeFiles/types_test.dir/interval_test.cpp.o"
+  "CMakeFiles/types_test.dir/interval_test.cpp.o.d"
+  "CMakeFiles/types_test.dir/null_mask_test.cpp.o"
+  "CMakeFiles/types_test.dir/null_mask_test.cpp.o.d"
+  "CMakeFiles/types_test.dir/string_test.cpp.o"
+  "CMakeFiles/types_test.dir/string_test.cpp.o.d"
+  "CMakeFiles/types_test.dir/time_test.cpp.o"
+  "CMakeFiles/types_test.dir/time_test.cpp.o.d"
+  "CMakeFiles/types_test.dir/timestamp_test.cpp.o"
+  "CMakeFiles/types_test.dir/timestamp_test.cpp.o.d"
+  "types_test"
+  "types_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_tests.dir/copy_test.cpp.o"
+  "CMakeFiles/copy_tests.dir/copy_test.cpp.o.d"
+  "CMakeFiles/copy_tests.dir/mapped_file_test.cpp.o"
+  "CMakeFiles/copy_tests.dir/mapped_file_test.cpp.o.d"
+  "CMakeFiles/copy_tests.dir/multi_copy_test.cpp.o"
+  "CMakeFiles/copy_tests.dir/multi_copy_test.cpp.o.d"
+  "copy_tests"
+  "copy_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copy_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
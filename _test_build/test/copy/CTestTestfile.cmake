@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/copy
+# Build directory: /root/repo/_test_build/test/copy
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_test_build/test/copy/copy_tests[1]_include.cmake")
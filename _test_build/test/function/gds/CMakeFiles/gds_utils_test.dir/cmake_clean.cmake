@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gds_utils_test.dir/gds_utils_test.cpp.o"
+  "CMakeFiles/gds_utils_test.dir/gds_utils_test.cpp.o.d"
+  "gds_utils_test"
+  "gds_utils_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gds_utils_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
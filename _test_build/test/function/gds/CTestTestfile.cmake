@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/function/gds
+# Build directory: /root/repo/_test_build/test/function/gds
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_test_build/test/function/gds/gds_utils_test[1]_include.cmake")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/api_graph_test.dir/base_graph_test.cpp.o"
+  "CMakeFiles/api_graph_test.dir/base_graph_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/api_graph_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
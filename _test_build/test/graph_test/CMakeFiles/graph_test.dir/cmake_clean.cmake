@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graph_test.dir/base_graph_test.cpp.o"
+  "CMakeFiles/graph_test.dir/base_graph_test.cpp.o.d"
+  "CMakeFiles/graph_test.dir/graph_test.cpp.o"
+  "CMakeFiles/graph_test.dir/graph_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graph_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/main/arrow_test.cpp" "test/main/CMakeFiles/main_test.dir/arrow_test.cpp.o" "gcc" "test/main/CMakeFiles/main_test.dir/arrow_test.cpp.o.d"
+  "/root/repo/test/main/connection_test.cpp" "test/main/CMakeFiles/main_test.dir/connection_test.cpp.o" "gcc" "test/main/CMakeFiles/main_test.dir/connection_test.cpp.o.d"
+  "/root/repo/test/main/db_locking_test.cpp" "test/main/CMakeFiles/main_test.dir/db_locking_test.cpp.o" "gcc" "test/main/CMakeFiles/main_test.dir/db_locking_test.cpp.o.d"
+  "/root/repo/test/main/prepare_test.cpp" "test/main/CMakeFiles/main_test.dir/prepare_test.cpp.o" "gcc" "test/main/CMakeFiles/main_test.dir/prepare_test.cpp.o.d"
+  "/root/repo/test/main/result_value_test.cpp" "test/main/CMakeFiles/main_test.dir/result_value_test.cpp.o" "gcc" "test/main/CMakeFiles/main_test.dir/result_value_test.cpp.o.d"
+  "/root/repo/test/main/storage_driver_test.cpp" "test/main/CMakeFiles/main_test.dir/storage_driver_test.cpp.o" "gcc" "test/main/CMakeFiles/main_test.dir/storage_driver_test.cpp.o.d"
+  "/root/repo/test/main/system_config_test.cpp" "test/main/CMakeFiles/main_test.dir/system_config_test.cpp.o" "gcc" "test/main/CMakeFiles/main_test.dir/system_config_test.cpp.o.d"
+  "/root/repo/test/main/udf_test.cpp" "test/main/CMakeFiles/main_test.dir/udf_test.cpp.o" "gcc" "test/main/CMakeFiles/main_test.dir/udf_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/CMakeFiles/kuzu_shared.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/antlr4_cypher/CMakeFiles/antlr4_cypher.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/brotli/CMakeFiles/brotlidec.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/brotli/CMakeFiles/brotlicommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/utf8proc/CMakeFiles/utf8proc.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/re2/CMakeFiles/re2.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/serd/CMakeFiles/serd.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/fastpfor/CMakeFiles/fastpfor.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/miniparquet/CMakeFiles/miniparquet.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/zstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/miniz/CMakeFiles/miniz.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/mbedtls/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/_test_build/third_party/lz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,26 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/main_test.dir/arrow_test.cpp.o"
+  "CMakeFiles/main_test.dir/arrow_test.cpp.o.d"
+  "CMakeFiles/main_test.dir/connection_test.cpp.o"
+  "CMakeFiles/main_test.dir/connection_test.cpp.o.d"
+  "CMakeFiles/main_test.dir/db_locking_test.cpp.o"
+  "CMakeFiles/main_test.dir/db_locking_test.cpp.o.d"
+  "CMakeFiles/main_test.dir/prepare_test.cpp.o"
+  "CMakeFiles/main_test.dir/prepare_test.cpp.o.d"
+  "CMakeFiles/main_test.dir/result_value_test.cpp.o"
+  "CMakeFiles/main_test.dir/result_value_test.cpp.o.d"
+  "CMakeFiles/main_test.dir/storage_driver_test.cpp.o"
+  "CMakeFiles/main_test.dir/storage_driver_test.cpp.o.d"
+  "CMakeFiles/main_test.dir/system_config_test.cpp.o"
+  "CMakeFiles/main_test.dir/system_config_test.cpp.o.d"
+  "CMakeFiles/main_test.dir/udf_test.cpp.o"
+  "CMakeFiles/main_test.dir/udf_test.cpp.o.d"
+  "main_test"
+  "main_test.pdb"
+  "main_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/main
+# Build directory: /root/repo/_test_build/test/main
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_test_build/test/main/main_test[1]_include.cmake")
+include("/root/repo/_test_build/test/main/transaction_test[1]_include.cmake")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_test_build/test/main/main_test[1]_tests.cmake")
+  include("/root/repo/_test_build/test/main/main_test[1]_tests.cmake")
+else()
+  add_test(main_test_NOT_BUILT main_test_NOT_BUILT)
+endif()
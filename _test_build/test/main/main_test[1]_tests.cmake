@@ -0,0 +1,183 @@
+add_test([=[SystemConfigTest.testAccessMode]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=SystemConfigTest.testAccessMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SystemConfigTest.testAccessMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SystemConfigTest.testMaxDBSize]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=SystemConfigTest.testMaxDBSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SystemConfigTest.testMaxDBSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SystemConfigTest.testBufferPoolSize]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=SystemConfigTest.testBufferPoolSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SystemConfigTest.testBufferPoolSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ArrowTest.getArrowResult]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ArrowTest.getArrowResult]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ArrowTest.getArrowResult]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ArrowTest.getArrowSchema]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ArrowTest.getArrowSchema]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ArrowTest.getArrowSchema]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RDFArrowTest.getRDFArrowResult]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=RDFArrowTest.getRDFArrowResult]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RDFArrowTest.getRDFArrowResult]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.BasicConnect]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.BasicConnect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.BasicConnect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.ParallelQuerySingleConnect]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.ParallelQuerySingleConnect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.ParallelQuerySingleConnect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.ParallelReadWriteSingleConnect]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.ParallelReadWriteSingleConnect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.ParallelReadWriteSingleConnect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.ParallelLoadWithWarningsSingleConnect]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.ParallelLoadWithWarningsSingleConnect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.ParallelLoadWithWarningsSingleConnect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.ParallelConnect]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.ParallelConnect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.ParallelConnect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.CommitRollbackRemoveActiveTransaction]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.CommitRollbackRemoveActiveTransaction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.CommitRollbackRemoveActiveTransaction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.BeginningMultipleTransactionErrors]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.BeginningMultipleTransactionErrors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.BeginningMultipleTransactionErrors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.Explain]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.Explain]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.Explain]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.Profile]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.Profile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.Profile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.Interrupt]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.Interrupt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.Interrupt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.QueryAdmissionQueue]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.QueryAdmissionQueue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.QueryAdmissionQueue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.TimeOut]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.TimeOut]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.TimeOut]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.MultipleQueryExplain]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.MultipleQueryExplain]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.MultipleQueryExplain]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.MultipleQuery]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.MultipleQuery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.MultipleQuery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.SingleQueryHasNextQueryResult]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.SingleQueryHasNextQueryResult]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.SingleQueryHasNextQueryResult]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.Prepare]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.Prepare]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.Prepare]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.CreateTableAfterClosingDatabase]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.CreateTableAfterClosingDatabase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.CreateTableAfterClosingDatabase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PlanCache]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PlanCache]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PlanCache]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PlanCacheFiltersWithLiteralsOfEachQuery]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PlanCacheFiltersWithLiteralsOfEachQuery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PlanCacheFiltersWithLiteralsOfEachQuery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PlanCacheEvictsLeastRecentlyUsedQuery]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PlanCacheEvictsLeastRecentlyUsedQuery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PlanCacheEvictsLeastRecentlyUsedQuery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PlanCacheReplansMisestimatedQuery]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PlanCacheReplansMisestimatedQuery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PlanCacheReplansMisestimatedQuery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PlanCacheReplansWithOtherLiterals]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PlanCacheReplansWithOtherLiterals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PlanCacheReplansWithOtherLiterals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.issueTest1]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.issueTest1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.issueTest1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.issueTest2]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.issueTest2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.issueTest2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.issueTest]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.issueTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.issueTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.MultiParamsPrepare]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.MultiParamsPrepare]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.MultiParamsPrepare]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareBool]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareBool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareBool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareInt]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareInt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareInt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareDouble]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareDouble]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareDouble]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareString]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareDate]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareDate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareDate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareTimestamp]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareTimestamp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareTimestamp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareInterval]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareInterval]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareInterval]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareDefaultParam]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareDefaultParam]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareDefaultParam]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareDefaultListParam]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareDefaultListParam]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareDefaultListParam]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareDefaultStructParam]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareDefaultStructParam]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareDefaultStructParam]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareDefaultMapParam]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareDefaultMapParam]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareDefaultMapParam]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareDefaultUnionParam]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareDefaultUnionParam]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareDefaultUnionParam]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareLargeJoin]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareLargeJoin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareLargeJoin]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.ParamNotExist]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.ParamNotExist]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.ParamNotExist]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.ParamTypeError]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.ParamTypeError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.ParamTypeError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.MultipleExecutionOfPreparedStatement]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.MultipleExecutionOfPreparedStatement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.MultipleExecutionOfPreparedStatement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.issueTest4]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.issueTest4]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.issueTest4]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.PrepareExport]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.PrepareExport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.PrepareExport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.ParameterWith]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.ParameterWith]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.ParameterWith]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.ReusePlanOfPreparedStatement]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.ReusePlanOfPreparedStatement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.ReusePlanOfPreparedStatement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.ExecuteBatch]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.ExecuteBatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.ExecuteBatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFInt64]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFInt64]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFInt64]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFInt128]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFInt128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFInt128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFInt8]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFInt8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFInt8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFUint8]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFUint8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFUint8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFUint16]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFUint16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFUint16]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFUint32]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFUint32]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFUint32]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFUint64]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFUint64]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFUint64]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.TestDropUDF]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.TestDropUDF]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.TestDropUDF]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.TestExceptUDF]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.TestExceptUDF]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.TestExceptUDF]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.TestZeroParamUDF]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.TestZeroParamUDF]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.TestZeroParamUDF]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFAddDate]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFAddDate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFAddDate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFFloat]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFFloat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFFloat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFDouble]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFDouble]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFDouble]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFString]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.BinaryUDFFlatUnflat]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.BinaryUDFFlatUnflat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.BinaryUDFFlatUnflat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.BinaryUDFStr]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.BinaryUDFStr]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.BinaryUDFStr]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.BinaryAddMicroSeconds]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.BinaryAddMicroSeconds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.BinaryAddMicroSeconds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.BinaryAddMicroSecondsTZ]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.BinaryAddMicroSecondsTZ]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.BinaryAddMicroSecondsTZ]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.BinaryAddNanoSeconds]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.BinaryAddNanoSeconds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.BinaryAddNanoSeconds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.BinaryAddMilliSeconds]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.BinaryAddMilliSeconds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.BinaryAddMilliSeconds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.BinaryAddSeconds]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.BinaryAddSeconds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.BinaryAddSeconds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.TernaryUDFInt]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.TernaryUDFInt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.TernaryUDFInt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.TernaryUDFStr]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.TernaryUDFStr]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.TernaryUDFStr]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UDFError]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UDFError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UDFError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UDFTypeError]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UDFTypeError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UDFTypeError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UnaryUDFMoreParamType]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UnaryUDFMoreParamType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UnaryUDFMoreParamType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.BinaryUDFMoreParamType]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.BinaryUDFMoreParamType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.BinaryUDFMoreParamType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.TernaryUDFMoreParamType]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.TernaryUDFMoreParamType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.TernaryUDFMoreParamType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.vectorizedUnaryAddFour]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.vectorizedUnaryAddFour]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.vectorizedUnaryAddFour]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.vectorizedBinaryAddDate]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.vectorizedBinaryAddDate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.vectorizedBinaryAddDate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.vectorizedTernaryConditionalAdd]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.vectorizedTernaryConditionalAdd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.vectorizedTernaryConditionalAdd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.UDFTrxTest]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.UDFTrxTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.UDFTrxTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ApiTest.CreateUDFExceptionTest]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ApiTest.CreateUDFExceptionTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ApiTest.CreateUDFExceptionTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBLockingTest.testReadLock]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=DBLockingTest.testReadLock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBLockingTest.testReadLock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBLockingTest.testWriteLock]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=DBLockingTest.testWriteLock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBLockingTest.testWriteLock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DBLockingTest.testReadOnly]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=DBLockingTest.testReadOnly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DBLockingTest.testReadOnly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResultValueTest.getNextException]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ResultValueTest.getNextException]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResultValueTest.getNextException]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResultValueTest.getResultValueException]=]  /root/repo/_test_build/test/main/main_test [==[--gtest_filter=ResultValueTest.getResultValueException]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResultValueTest.getResultValueException]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/test/main SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  main_test_TESTS SystemConfigTest.testAccessMode SystemConfigTest.testMaxDBSize SystemConfigTest.testBufferPoolSize ArrowTest.getArrowResult ArrowTest.getArrowSchema RDFArrowTest.getRDFArrowResult ApiTest.BasicConnect ApiTest.ParallelQuerySingleConnect ApiTest.ParallelReadWriteSingleConnect ApiTest.ParallelLoadWithWarningsSingleConnect ApiTest.ParallelConnect ApiTest.CommitRollbackRemoveActiveTransaction ApiTest.BeginningMultipleTransactionErrors ApiTest.Explain ApiTest.Profile ApiTest.Interrupt ApiTest.QueryAdmissionQueue ApiTest.TimeOut ApiTest.MultipleQueryExplain ApiTest.MultipleQuery ApiTest.SingleQueryHasNextQueryResult ApiTest.Prepare ApiTest.CreateTableAfterClosingDatabase ApiTest.PlanCache ApiTest.PlanCacheFiltersWithLiteralsOfEachQuery ApiTest.PlanCacheEvictsLeastRecentlyUsedQuery ApiTest.PlanCacheReplansMisestimatedQuery ApiTest.PlanCacheReplansWithOtherLiterals ApiTest.issueTest1 ApiTest.issueTest2 ApiTest.issueTest ApiTest.MultiParamsPrepare ApiTest.PrepareBool ApiTest.PrepareInt ApiTest.PrepareDouble ApiTest.PrepareString ApiTest.PrepareDate ApiTest.PrepareTimestamp ApiTest.PrepareInterval ApiTest.PrepareDefaultParam ApiTest.PrepareDefaultListParam ApiTest.PrepareDefaultStructParam ApiTest.PrepareDefaultMapParam ApiTest.PrepareDefaultUnionParam ApiTest.PrepareLargeJoin ApiTest.ParamNotExist ApiTest.ParamTypeError ApiTest.MultipleExecutionOfPreparedStatement ApiTest.issueTest4 ApiTest.PrepareExport ApiTest.ParameterWith ApiTest.ReusePlanOfPreparedStatement ApiTest.ExecuteBatch ApiTest.UnaryUDFInt64 ApiTest.UnaryUDFInt128 ApiTest.UnaryUDFInt8 ApiTest.UnaryUDFUint8 ApiTest.UnaryUDFUint16 ApiTest.UnaryUDFUint32 ApiTest.UnaryUDFUint64 ApiTest.TestDropUDF ApiTest.TestExceptUDF ApiTest.TestZeroParamUDF ApiTest.UnaryUDFAddDate ApiTest.UnaryUDFFloat ApiTest.UnaryUDFDouble ApiTest.UnaryUDFString ApiTest.BinaryUDFFlatUnflat ApiTest.BinaryUDFStr ApiTest.BinaryAddMicroSeconds ApiTest.BinaryAddMicroSecondsTZ ApiTest.BinaryAddNanoSeconds ApiTest.BinaryAddMilliSeconds ApiTest.BinaryAddSeconds ApiTest.TernaryUDFInt ApiTest.TernaryUDFStr ApiTest.UDFError ApiTest.UDFTypeError ApiTest.UnaryUDFMoreParamType ApiTest.BinaryUDFMoreParamType ApiTest.TernaryUDFMoreParamType ApiTest.vectorizedUnaryAddFour ApiTest.vectorizedBinaryAddDate ApiTest.vectorizedTernaryConditionalAdd ApiTest.UDFTrxTest ApiTest.CreateUDFExceptionTest DBLockingTest.testReadLock DBLockingTest.testWriteLock DBLockingTest.testReadOnly ResultValueTest.getNextException ResultValueTest.getResultValueException)
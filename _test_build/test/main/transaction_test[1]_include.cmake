@@ -0,0 +1,26 @@
+if(EXISTS "/root/repo/_test_build/test/main/transaction_test")
+  if(NOT EXISTS "/root/repo/_test_build/test/main/transaction_test[1]_tests.cmake" OR
+     NOT "/root/repo/_test_build/test/main/transaction_test[1]_tests.cmake" IS_NEWER_THAN "/root/repo/_test_build/test/main/transaction_test" OR
+     NOT "/root/repo/_test_build/test/main/transaction_test[1]_tests.cmake" IS_NEWER_THAN "${CMAKE_CURRENT_LIST_FILE}")
+    include("/usr/share/cmake-3.25/Modules/GoogleTestAddTests.cmake")
+    gtest_discover_tests_impl(
+      TEST_EXECUTABLE [==[/root/repo/_test_build/test/main/transaction_test]==]
+      TEST_EXECUTOR [==[]==]
+      TEST_WORKING_DIR [==[/root/repo/_test_build/test/main]==]
+      TEST_EXTRA_ARGS [==[]==]
+      TEST_PROPERTIES [==[]==]
+      TEST_PREFIX [==[]==]
+      TEST_SUFFIX [==[]==]
+      TEST_FILTER [==[]==]
+      NO_PRETTY_TYPES [==[FALSE]==]
+      NO_PRETTY_VALUES [==[FALSE]==]
+      TEST_LIST [==[transaction_test_TESTS]==]
+      CTEST_FILE [==[/root/repo/_test_build/test/main/transaction_test[1]_tests.cmake]==]
+      TEST_DISCOVERY_TIMEOUT [==[600]==]
+      TEST_XML_OUTPUT_DIR [==[]==]
+    )
+  endif()
+  include("/root/repo/_test_build/test/main/transaction_test[1]_tests.cmake")
+else()
+  add_test(transaction_test_NOT_BUILT transaction_test_NOT_BUILT)
+endif()
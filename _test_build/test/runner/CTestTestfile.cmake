@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/runner
+# Build directory: /root/repo/_test_build/test/runner
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_test_build/test/runner/e2e_test[1]_include.cmake")
+include("/root/repo/_test_build/test/runner/cleanup_test[1]_include.cmake")
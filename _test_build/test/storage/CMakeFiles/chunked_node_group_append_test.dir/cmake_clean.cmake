@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chunked_node_group_append_test.dir/chunked_node_group_append_test.cpp.o"
+  "CMakeFiles/chunked_node_group_append_test.dir/chunked_node_group_append_test.cpp.o.d"
+  "chunked_node_group_append_test"
+  "chunked_node_group_append_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chunked_node_group_append_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/column_chunk_metadata_test.dir/column_chunk_metadata_test.cpp.o"
+  "CMakeFiles/column_chunk_metadata_test.dir/column_chunk_metadata_test.cpp.o.d"
+  "column_chunk_metadata_test"
+  "column_chunk_metadata_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/column_chunk_metadata_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compression_test.dir/compress_chunk_test.cpp.o"
+  "CMakeFiles/compression_test.dir/compress_chunk_test.cpp.o.d"
+  "CMakeFiles/compression_test.dir/compression_test.cpp.o"
+  "CMakeFiles/compression_test.dir/compression_test.cpp.o.d"
+  "compression_test"
+  "compression_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compression_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
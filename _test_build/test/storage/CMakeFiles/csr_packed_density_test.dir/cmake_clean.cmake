@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/csr_packed_density_test.dir/csr_packed_density_test.cpp.o"
+  "CMakeFiles/csr_packed_density_test.dir/csr_packed_density_test.cpp.o.d"
+  "csr_packed_density_test"
+  "csr_packed_density_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csr_packed_density_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
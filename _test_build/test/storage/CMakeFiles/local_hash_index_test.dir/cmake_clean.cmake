@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_hash_index_test.dir/local_hash_index_test.cpp.o"
+  "CMakeFiles/local_hash_index_test.dir/local_hash_index_test.cpp.o.d"
+  "local_hash_index_test"
+  "local_hash_index_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_hash_index_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
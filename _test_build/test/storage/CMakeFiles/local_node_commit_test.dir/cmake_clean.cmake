@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_node_commit_test.dir/local_node_commit_test.cpp.o"
+  "CMakeFiles/local_node_commit_test.dir/local_node_commit_test.cpp.o.d"
+  "local_node_commit_test"
+  "local_node_commit_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_node_commit_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
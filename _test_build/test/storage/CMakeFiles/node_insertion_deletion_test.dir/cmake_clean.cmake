@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/node_insertion_deletion_test.dir/node_insertion_deletion_test.cpp.o"
+  "CMakeFiles/node_insertion_deletion_test.dir/node_insertion_deletion_test.cpp.o.d"
+  "node_insertion_deletion_test"
+  "node_insertion_deletion_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/node_insertion_deletion_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/node_update_test.dir/node_update_test.cpp.o"
+  "CMakeFiles/node_update_test.dir/node_update_test.cpp.o.d"
+  "node_update_test"
+  "node_update_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/node_update_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
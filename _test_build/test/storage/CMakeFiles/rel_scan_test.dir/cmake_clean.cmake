@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rel_scan_test.dir/rel_scan_test.cpp.o"
+  "CMakeFiles/rel_scan_test.dir/rel_scan_test.cpp.o.d"
+  "rel_scan_test"
+  "rel_scan_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rel_scan_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/storage
+# Build directory: /root/repo/_test_build/test/storage
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_test_build/test/storage/node_insertion_deletion_test[1]_include.cmake")
+include("/root/repo/_test_build/test/storage/compression_test[1]_include.cmake")
+include("/root/repo/_test_build/test/storage/column_chunk_metadata_test[1]_include.cmake")
+include("/root/repo/_test_build/test/storage/local_hash_index_test[1]_include.cmake")
+include("/root/repo/_test_build/test/storage/buffer_manager_test[1]_include.cmake")
+include("/root/repo/_test_build/test/storage/rel_scan_test[1]_include.cmake")
+include("/root/repo/_test_build/test/storage/node_update_test[1]_include.cmake")
+include("/root/repo/_test_build/test/storage/local_node_commit_test[1]_include.cmake")
+include("/root/repo/_test_build/test/storage/chunked_node_group_append_test[1]_include.cmake")
+include("/root/repo/_test_build/test/storage/csr_packed_density_test[1]_include.cmake")
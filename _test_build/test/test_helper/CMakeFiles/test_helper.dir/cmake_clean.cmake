@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_helper.dir/test_helper.cpp.o"
+  "CMakeFiles/test_helper.dir/test_helper.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_helper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/test_runner/csv_converter.cpp" "test/test_runner/CMakeFiles/test_runner.dir/csv_converter.cpp.o" "gcc" "test/test_runner/CMakeFiles/test_runner.dir/csv_converter.cpp.o.d"
+  "/root/repo/test/test_runner/insert_by_row.cpp" "test/test_runner/CMakeFiles/test_runner.dir/insert_by_row.cpp.o" "gcc" "test/test_runner/CMakeFiles/test_runner.dir/insert_by_row.cpp.o.d"
+  "/root/repo/test/test_runner/multi_copy_split.cpp" "test/test_runner/CMakeFiles/test_runner.dir/multi_copy_split.cpp.o" "gcc" "test/test_runner/CMakeFiles/test_runner.dir/multi_copy_split.cpp.o.d"
+  "/root/repo/test/test_runner/test_parser.cpp" "test/test_runner/CMakeFiles/test_runner.dir/test_parser.cpp.o" "gcc" "test/test_runner/CMakeFiles/test_runner.dir/test_parser.cpp.o.d"
+  "/root/repo/test/test_runner/test_runner.cpp" "test/test_runner/CMakeFiles/test_runner.dir/test_runner.cpp.o" "gcc" "test/test_runner/CMakeFiles/test_runner.dir/test_runner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
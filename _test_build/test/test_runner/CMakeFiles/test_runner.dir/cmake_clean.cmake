@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_runner.dir/csv_converter.cpp.o"
+  "CMakeFiles/test_runner.dir/csv_converter.cpp.o.d"
+  "CMakeFiles/test_runner.dir/insert_by_row.cpp.o"
+  "CMakeFiles/test_runner.dir/insert_by_row.cpp.o.d"
+  "CMakeFiles/test_runner.dir/multi_copy_split.cpp.o"
+  "CMakeFiles/test_runner.dir/multi_copy_split.cpp.o.d"
+  "CMakeFiles/test_runner.dir/test_parser.cpp.o"
+  "CMakeFiles/test_runner.dir/test_parser.cpp.o.d"
+  "CMakeFiles/test_runner.dir/test_runner.cpp.o"
+  "CMakeFiles/test_runner.dir/test_runner.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_runner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
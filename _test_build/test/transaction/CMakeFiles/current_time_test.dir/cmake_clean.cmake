@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/current_time_test.dir/current_time_test.cpp.o"
+  "CMakeFiles/current_time_test.dir/current_time_test.cpp.o.d"
+  "current_time_test"
+  "current_time_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/current_time_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
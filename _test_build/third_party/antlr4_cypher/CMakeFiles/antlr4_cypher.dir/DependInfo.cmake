@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/antlr4_cypher/cypher_lexer.cpp" "third_party/antlr4_cypher/CMakeFiles/antlr4_cypher.dir/cypher_lexer.cpp.o" "gcc" "third_party/antlr4_cypher/CMakeFiles/antlr4_cypher.dir/cypher_lexer.cpp.o.d"
+  "/root/repo/third_party/antlr4_cypher/cypher_parser.cpp" "third_party/antlr4_cypher/CMakeFiles/antlr4_cypher.dir/cypher_parser.cpp.o" "gcc" "third_party/antlr4_cypher/CMakeFiles/antlr4_cypher.dir/cypher_parser.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/third_party/antlr4_cypher/cypher_parser.cpp" "/root/repo/third_party/antlr4_cypher/cypher_lexer.cpp"
+  "/root/repo/third_party/antlr4_cypher/include/cypher_lexer.h" "/root/repo/third_party/antlr4_cypher/cypher_lexer.cpp"
+  "/root/repo/third_party/antlr4_cypher/include/cypher_parser.h" "/root/repo/third_party/antlr4_cypher/cypher_lexer.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "/root/repo/third_party/antlr4_cypher/cypher_lexer.cpp"
+  "/root/repo/third_party/antlr4_cypher/cypher_parser.cpp"
+  "/root/repo/third_party/antlr4_cypher/include/cypher_lexer.h"
+  "/root/repo/third_party/antlr4_cypher/include/cypher_parser.h"
+  "CMakeFiles/antlr4_cypher.dir/cypher_lexer.cpp.o"
+  "CMakeFiles/antlr4_cypher.dir/cypher_lexer.cpp.o.d"
+  "CMakeFiles/antlr4_cypher.dir/cypher_parser.cpp.o"
+  "CMakeFiles/antlr4_cypher.dir/cypher_parser.cpp.o.d"
+  "libantlr4_cypher.a"
+  "libantlr4_cypher.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/antlr4_cypher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libantlr4_cypher.a"
+)
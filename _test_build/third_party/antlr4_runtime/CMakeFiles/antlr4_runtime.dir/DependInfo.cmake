@@ -0,0 +1,154 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/antlr4_runtime/src/ANTLRErrorListener.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ANTLRErrorListener.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ANTLRErrorListener.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/ANTLRErrorStrategy.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ANTLRErrorStrategy.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ANTLRErrorStrategy.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/ANTLRFileStream.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ANTLRFileStream.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ANTLRFileStream.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/ANTLRInputStream.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ANTLRInputStream.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ANTLRInputStream.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/BailErrorStrategy.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/BailErrorStrategy.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/BailErrorStrategy.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/BaseErrorListener.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/BaseErrorListener.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/BaseErrorListener.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/BufferedTokenStream.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/BufferedTokenStream.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/BufferedTokenStream.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/CharStream.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/CharStream.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/CharStream.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/CommonToken.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/CommonToken.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/CommonToken.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/CommonTokenFactory.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/CommonTokenFactory.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/CommonTokenFactory.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/CommonTokenStream.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/CommonTokenStream.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/CommonTokenStream.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/ConsoleErrorListener.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ConsoleErrorListener.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ConsoleErrorListener.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/DefaultErrorStrategy.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/DefaultErrorStrategy.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/DefaultErrorStrategy.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/DiagnosticErrorListener.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/DiagnosticErrorListener.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/DiagnosticErrorListener.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/Exceptions.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Exceptions.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Exceptions.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/FailedPredicateException.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/FailedPredicateException.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/FailedPredicateException.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/InputMismatchException.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/InputMismatchException.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/InputMismatchException.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/IntStream.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/IntStream.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/IntStream.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/InterpreterRuleContext.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/InterpreterRuleContext.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/InterpreterRuleContext.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/Lexer.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Lexer.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Lexer.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/LexerInterpreter.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/LexerInterpreter.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/LexerInterpreter.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/LexerNoViableAltException.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/LexerNoViableAltException.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/LexerNoViableAltException.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/ListTokenSource.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ListTokenSource.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ListTokenSource.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/NoViableAltException.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/NoViableAltException.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/NoViableAltException.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/Parser.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Parser.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Parser.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/ParserInterpreter.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ParserInterpreter.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ParserInterpreter.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/ParserRuleContext.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ParserRuleContext.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ParserRuleContext.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/ProxyErrorListener.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ProxyErrorListener.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/ProxyErrorListener.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/RecognitionException.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/RecognitionException.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/RecognitionException.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/Recognizer.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Recognizer.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Recognizer.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/RuleContext.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/RuleContext.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/RuleContext.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/RuleContextWithAltNum.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/RuleContextWithAltNum.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/RuleContextWithAltNum.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/RuntimeMetaData.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/RuntimeMetaData.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/RuntimeMetaData.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/Token.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Token.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Token.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/TokenSource.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/TokenSource.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/TokenSource.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/TokenStream.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/TokenStream.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/TokenStream.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/TokenStreamRewriter.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/TokenStreamRewriter.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/TokenStreamRewriter.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/UnbufferedCharStream.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/UnbufferedCharStream.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/UnbufferedCharStream.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/UnbufferedTokenStream.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/UnbufferedTokenStream.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/UnbufferedTokenStream.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/Vocabulary.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Vocabulary.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/Vocabulary.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/WritableToken.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/WritableToken.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/WritableToken.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ATN.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATN.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATN.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ATNConfig.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNConfig.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNConfig.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ATNConfigSet.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNConfigSet.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNConfigSet.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ATNDeserializationOptions.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNDeserializationOptions.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNDeserializationOptions.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ATNDeserializer.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNDeserializer.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNDeserializer.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ATNSimulator.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNSimulator.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNSimulator.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ATNState.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNState.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNState.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ATNStateType.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNStateType.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ATNStateType.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ActionTransition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ActionTransition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ActionTransition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/AmbiguityInfo.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/AmbiguityInfo.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/AmbiguityInfo.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ArrayPredictionContext.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ArrayPredictionContext.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ArrayPredictionContext.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/AtomTransition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/AtomTransition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/AtomTransition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ContextSensitivityInfo.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ContextSensitivityInfo.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ContextSensitivityInfo.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/DecisionEventInfo.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/DecisionEventInfo.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/DecisionEventInfo.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/DecisionInfo.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/DecisionInfo.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/DecisionInfo.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/DecisionState.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/DecisionState.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/DecisionState.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/EpsilonTransition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/EpsilonTransition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/EpsilonTransition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ErrorInfo.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ErrorInfo.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ErrorInfo.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LL1Analyzer.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LL1Analyzer.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LL1Analyzer.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerATNConfig.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerATNConfig.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerATNConfig.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerATNSimulator.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerATNSimulator.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerATNSimulator.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerAction.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerAction.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerAction.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerActionExecutor.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerActionExecutor.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerActionExecutor.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerChannelAction.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerChannelAction.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerChannelAction.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerCustomAction.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerCustomAction.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerCustomAction.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerIndexedCustomAction.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerIndexedCustomAction.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerIndexedCustomAction.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerModeAction.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerModeAction.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerModeAction.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerMoreAction.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerMoreAction.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerMoreAction.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerPopModeAction.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerPopModeAction.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerPopModeAction.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerPushModeAction.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerPushModeAction.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerPushModeAction.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerSkipAction.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerSkipAction.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerSkipAction.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LexerTypeAction.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerTypeAction.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LexerTypeAction.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/LookaheadEventInfo.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LookaheadEventInfo.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/LookaheadEventInfo.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/NotSetTransition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/NotSetTransition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/NotSetTransition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/OrderedATNConfigSet.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/OrderedATNConfigSet.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/OrderedATNConfigSet.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ParseInfo.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ParseInfo.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ParseInfo.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ParserATNSimulator.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ParserATNSimulator.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ParserATNSimulator.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/PrecedencePredicateTransition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PrecedencePredicateTransition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PrecedencePredicateTransition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/PredicateEvalInfo.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredicateEvalInfo.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredicateEvalInfo.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/PredicateTransition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredicateTransition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredicateTransition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/PredictionContext.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContext.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContext.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/PredictionContextCache.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContextCache.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContextCache.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/PredictionContextMergeCache.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContextMergeCache.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContextMergeCache.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/PredictionMode.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredictionMode.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/PredictionMode.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/ProfilingATNSimulator.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ProfilingATNSimulator.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/ProfilingATNSimulator.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/RangeTransition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/RangeTransition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/RangeTransition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/RuleTransition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/RuleTransition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/RuleTransition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/SemanticContext.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/SemanticContext.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/SemanticContext.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/SetTransition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/SetTransition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/SetTransition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/SingletonPredictionContext.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/SingletonPredictionContext.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/SingletonPredictionContext.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/StarLoopbackState.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/StarLoopbackState.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/StarLoopbackState.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/Transition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/Transition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/Transition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/TransitionType.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/TransitionType.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/TransitionType.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/atn/WildcardTransition.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/WildcardTransition.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/atn/WildcardTransition.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/dfa/DFA.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/dfa/DFA.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/dfa/DFA.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/dfa/DFASerializer.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/dfa/DFASerializer.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/dfa/DFASerializer.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/dfa/DFAState.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/dfa/DFAState.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/dfa/DFAState.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/dfa/LexerDFASerializer.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/dfa/LexerDFASerializer.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/dfa/LexerDFASerializer.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/internal/Synchronization.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/internal/Synchronization.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/internal/Synchronization.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/misc/InterpreterDataReader.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/misc/InterpreterDataReader.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/misc/InterpreterDataReader.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/misc/Interval.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/misc/Interval.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/misc/Interval.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/misc/IntervalSet.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/misc/IntervalSet.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/misc/IntervalSet.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/misc/MurmurHash.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/misc/MurmurHash.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/misc/MurmurHash.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/misc/Predicate.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/misc/Predicate.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/misc/Predicate.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/support/Any.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/support/Any.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/support/Any.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/support/Arrays.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/support/Arrays.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/support/Arrays.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/support/CPPUtils.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/support/CPPUtils.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/support/CPPUtils.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/support/StringUtils.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/support/StringUtils.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/support/StringUtils.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/support/Utf8.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/support/Utf8.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/support/Utf8.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/ErrorNodeImpl.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/ErrorNodeImpl.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/ErrorNodeImpl.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/IterativeParseTreeWalker.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/IterativeParseTreeWalker.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/IterativeParseTreeWalker.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/ParseTree.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/ParseTree.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/ParseTree.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/ParseTreeListener.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeListener.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeListener.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/ParseTreeVisitor.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeVisitor.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeVisitor.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/ParseTreeWalker.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeWalker.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeWalker.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/TerminalNodeImpl.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/TerminalNodeImpl.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/TerminalNodeImpl.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/Trees.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/Trees.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/Trees.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/pattern/Chunk.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/Chunk.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/Chunk.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/pattern/ParseTreeMatch.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreeMatch.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreeMatch.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/pattern/ParseTreePattern.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreePattern.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreePattern.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/pattern/ParseTreePatternMatcher.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreePatternMatcher.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreePatternMatcher.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/pattern/RuleTagToken.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/RuleTagToken.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/RuleTagToken.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/pattern/TagChunk.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TagChunk.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TagChunk.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/pattern/TextChunk.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TextChunk.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TextChunk.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/pattern/TokenTagToken.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TokenTagToken.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TokenTagToken.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/xpath/XPath.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPath.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPath.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/xpath/XPathElement.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathElement.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathElement.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/xpath/XPathLexer.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathLexer.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathLexer.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/xpath/XPathLexerErrorListener.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathLexerErrorListener.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathLexerErrorListener.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/xpath/XPathRuleAnywhereElement.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathRuleAnywhereElement.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathRuleAnywhereElement.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/xpath/XPathRuleElement.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathRuleElement.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathRuleElement.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/xpath/XPathTokenAnywhereElement.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathTokenAnywhereElement.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathTokenAnywhereElement.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/xpath/XPathTokenElement.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathTokenElement.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathTokenElement.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/xpath/XPathWildcardAnywhereElement.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathWildcardAnywhereElement.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathWildcardAnywhereElement.cpp.o.d"
+  "/root/repo/third_party/antlr4_runtime/src/tree/xpath/XPathWildcardElement.cpp" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathWildcardElement.cpp.o" "gcc" "third_party/antlr4_runtime/CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathWildcardElement.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,281 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/antlr4_runtime.dir/src/ANTLRErrorListener.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/ANTLRErrorListener.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/ANTLRErrorStrategy.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/ANTLRErrorStrategy.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/ANTLRFileStream.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/ANTLRFileStream.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/ANTLRInputStream.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/ANTLRInputStream.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/BailErrorStrategy.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/BailErrorStrategy.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/BaseErrorListener.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/BaseErrorListener.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/BufferedTokenStream.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/BufferedTokenStream.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/CharStream.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/CharStream.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/CommonToken.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/CommonToken.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/CommonTokenFactory.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/CommonTokenFactory.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/CommonTokenStream.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/CommonTokenStream.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/ConsoleErrorListener.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/ConsoleErrorListener.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/DefaultErrorStrategy.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/DefaultErrorStrategy.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/DiagnosticErrorListener.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/DiagnosticErrorListener.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/Exceptions.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/Exceptions.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/FailedPredicateException.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/FailedPredicateException.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/InputMismatchException.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/InputMismatchException.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/IntStream.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/IntStream.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/InterpreterRuleContext.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/InterpreterRuleContext.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/Lexer.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/Lexer.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/LexerInterpreter.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/LexerInterpreter.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/LexerNoViableAltException.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/LexerNoViableAltException.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/ListTokenSource.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/ListTokenSource.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/NoViableAltException.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/NoViableAltException.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/Parser.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/Parser.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/ParserInterpreter.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/ParserInterpreter.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/ParserRuleContext.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/ParserRuleContext.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/ProxyErrorListener.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/ProxyErrorListener.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/RecognitionException.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/RecognitionException.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/Recognizer.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/Recognizer.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/RuleContext.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/RuleContext.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/RuleContextWithAltNum.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/RuleContextWithAltNum.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/RuntimeMetaData.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/RuntimeMetaData.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/Token.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/Token.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/TokenSource.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/TokenSource.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/TokenStream.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/TokenStream.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/TokenStreamRewriter.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/TokenStreamRewriter.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/UnbufferedCharStream.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/UnbufferedCharStream.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/UnbufferedTokenStream.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/UnbufferedTokenStream.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/Vocabulary.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/Vocabulary.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/WritableToken.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/WritableToken.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATN.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATN.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNConfig.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNConfig.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNConfigSet.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNConfigSet.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNDeserializationOptions.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNDeserializationOptions.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNDeserializer.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNDeserializer.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNSimulator.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNSimulator.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNState.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNState.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNStateType.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ATNStateType.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ActionTransition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ActionTransition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/AmbiguityInfo.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/AmbiguityInfo.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ArrayPredictionContext.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ArrayPredictionContext.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/AtomTransition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/AtomTransition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ContextSensitivityInfo.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ContextSensitivityInfo.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/DecisionEventInfo.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/DecisionEventInfo.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/DecisionInfo.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/DecisionInfo.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/DecisionState.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/DecisionState.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/EpsilonTransition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/EpsilonTransition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ErrorInfo.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ErrorInfo.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LL1Analyzer.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LL1Analyzer.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerATNConfig.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerATNConfig.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerATNSimulator.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerATNSimulator.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerAction.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerAction.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerActionExecutor.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerActionExecutor.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerChannelAction.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerChannelAction.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerCustomAction.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerCustomAction.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerIndexedCustomAction.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerIndexedCustomAction.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerModeAction.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerModeAction.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerMoreAction.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerMoreAction.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerPopModeAction.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerPopModeAction.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerPushModeAction.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerPushModeAction.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerSkipAction.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerSkipAction.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerTypeAction.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LexerTypeAction.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LookaheadEventInfo.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/LookaheadEventInfo.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/NotSetTransition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/NotSetTransition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/OrderedATNConfigSet.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/OrderedATNConfigSet.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ParseInfo.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ParseInfo.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ParserATNSimulator.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ParserATNSimulator.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PrecedencePredicateTransition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PrecedencePredicateTransition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredicateEvalInfo.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredicateEvalInfo.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredicateTransition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredicateTransition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContext.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContext.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContextCache.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContextCache.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContextMergeCache.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredictionContextMergeCache.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredictionMode.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/PredictionMode.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ProfilingATNSimulator.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/ProfilingATNSimulator.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/RangeTransition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/RangeTransition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/RuleTransition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/RuleTransition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/SemanticContext.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/SemanticContext.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/SetTransition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/SetTransition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/SingletonPredictionContext.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/SingletonPredictionContext.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/StarLoopbackState.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/StarLoopbackState.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/Transition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/Transition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/TransitionType.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/TransitionType.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/WildcardTransition.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/atn/WildcardTransition.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/dfa/DFA.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/dfa/DFA.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/dfa/DFASerializer.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/dfa/DFASerializer.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/dfa/DFAState.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/dfa/DFAState.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/dfa/LexerDFASerializer.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/dfa/LexerDFASerializer.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/internal/Synchronization.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/internal/Synchronization.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/misc/InterpreterDataReader.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/misc/InterpreterDataReader.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/misc/Interval.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/misc/Interval.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/misc/IntervalSet.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/misc/IntervalSet.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/misc/MurmurHash.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/misc/MurmurHash.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/misc/Predicate.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/misc/Predicate.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/support/Any.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/support/Any.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/support/Arrays.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/support/Arrays.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/support/CPPUtils.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/support/CPPUtils.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/support/StringUtils.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/support/StringUtils.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/support/Utf8.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/support/Utf8.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/ErrorNodeImpl.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/ErrorNodeImpl.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/IterativeParseTreeWalker.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/IterativeParseTreeWalker.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/ParseTree.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/ParseTree.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeListener.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeListener.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeVisitor.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeVisitor.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeWalker.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/ParseTreeWalker.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/TerminalNodeImpl.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/TerminalNodeImpl.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/Trees.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/Trees.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/Chunk.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/Chunk.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreeMatch.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreeMatch.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreePattern.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreePattern.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreePatternMatcher.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/ParseTreePatternMatcher.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/RuleTagToken.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/RuleTagToken.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TagChunk.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TagChunk.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TextChunk.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TextChunk.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TokenTagToken.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/pattern/TokenTagToken.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPath.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPath.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathElement.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathElement.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathLexer.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathLexer.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathLexerErrorListener.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathLexerErrorListener.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathRuleAnywhereElement.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathRuleAnywhereElement.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathRuleElement.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathRuleElement.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathTokenAnywhereElement.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathTokenAnywhereElement.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathTokenElement.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathTokenElement.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathWildcardAnywhereElement.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathWildcardAnywhereElement.cpp.o.d"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathWildcardElement.cpp.o"
+  "CMakeFiles/antlr4_runtime.dir/src/tree/xpath/XPathWildcardElement.cpp.o.d"
+  "libantlr4_runtime.a"
+  "libantlr4_runtime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/antlr4_runtime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()